@@ -0,0 +1,105 @@
+#ifndef __CHECKPOINT_INDEX_HPP__
+#define __CHECKPOINT_INDEX_HPP__
+
+#include <string>
+#include <vector>
+
+/**
+ * The CheckpointIndex class. A sparse index of a tokenized input.
+ * Every 'interval' bytes, it records the offset of the next token start and the number of tokens before it.
+ * As the lexer restarts from its start state after each token, a window of the input can then be lexed
+ * from the closest checkpoint instead of from the beginning.
+ */
+class CheckpointIndex {
+    public:
+        static constexpr size_t DefaultInterval = 64 * 1024;    //< The default distance between two checkpoints.
+
+        /**
+         * A checkpoint of the index.
+         */
+        struct Checkpoint {
+            size_t offset;      //< The offset of a token start.
+            size_t tokenIndex;  //< The number of tokens before that offset.
+        };
+
+        /**
+         * A constructor.
+         * Constructs an empty index.
+         * @param interval - size_t - The minimum number of bytes between two checkpoints.
+         */
+        CheckpointIndex(size_t interval = DefaultInterval);
+
+        /**
+         * A function that records a token start, keeping it if it is far enough from the last checkpoint.
+         * @param offset - size_t - The offset of the token.
+         * @param tokenIndex - size_t - The index of the token.
+         */
+        void record(size_t offset, size_t tokenIndex);
+
+        /**
+         * A function that records the end of the indexed input.
+         * @param inputLength - size_t - The length of the input.
+         * @param tokenCount - size_t - The number of tokens of the input.
+         */
+        void finish(size_t inputLength, size_t tokenCount);
+
+        /**
+         * A function that returns the last checkpoint before a token.
+         * @param tokenIndex - size_t - The index of the token.
+         * @return const Checkpoint& - The checkpoint.
+         */
+        const Checkpoint& checkpointForToken(size_t tokenIndex) const;
+
+        /**
+         * A function that returns the last checkpoint at or before an offset.
+         * @param offset - size_t - The offset in the input.
+         * @return const Checkpoint& - The checkpoint.
+         */
+        const Checkpoint& checkpointForOffset(size_t offset) const;
+
+        /**
+         * A function that returns the minimum distance between two checkpoints.
+         * @return size_t - The number of bytes.
+         */
+        size_t interval() const { return mInterval; }
+
+        /**
+         * A function that returns the length of the indexed input.
+         * @return size_t - The length given to finish.
+         */
+        size_t inputLength() const { return mInputLength; }
+
+        /**
+         * A function that returns the number of tokens of the indexed input.
+         * @return size_t - The number of tokens given to finish.
+         */
+        size_t tokenCount() const { return mTokenCount; }
+
+        /**
+         * A function that returns the checkpoints of the index.
+         * @return const std::vector<Checkpoint>& - The checkpoints, sorted by offset.
+         */
+        const std::vector<Checkpoint>& checkpoints() const { return mCheckpoints; }
+
+        /**
+         * A function that reads an index from a file.
+         * @param filename - std::string - The index file name.
+         * @return CheckpointIndex - The index.
+         */
+        static CheckpointIndex loadFromFilename(const std::string& filename);
+
+        /**
+         * A function that writes the index to a file (in CBOR).
+         * @param filename - std::string - The index file name.
+         * @return bool - Returns true if it succeeded
+         */
+        bool saveToFile(const std::string& filename) const;
+
+    private:
+        size_t mInterval;                       //< The minimum distance between two checkpoints.
+        size_t mInputLength;                    //< The length of the indexed input.
+        size_t mTokenCount;                     //< The number of tokens of the indexed input.
+        std::vector<Checkpoint> mCheckpoints;   //< The checkpoints, sorted by offset.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef __DFA_TABLE_HPP__
+#define __DFA_TABLE_HPP__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "NFA.hpp"
+
+/**
+ * Match structure.
+ * Represents the result of running a DFA from the start of a token.
+ */
+struct Match {
+    size_t length;      //< The length of the longest accepted prefix (0 if there is none).
+    size_t scanned;     //< The number of characters read before the DFA stopped.
+    int token;          //< The token id of the longest accepted prefix (-1 if there is none).
+};
+
+/**
+ * A class representing a DFA as a dense transition table.
+ * Each state owns a row of 256 transitions and the token types are resolved to integer ids.
+ */
+class DFATable {
+    public:
+        static constexpr uint32_t DeadState = 0xFFFFFFFF;   //< The index used for missing transitions.
+
+        /**
+         * A constructor.
+         * Constructs the dense table of a deterministic NFA (as returned by NFA::toDFA).
+         * @param dfa - NFA - The DFA to convert.
+         */
+        DFATable(const NFA& dfa);
+
+        /**
+         * A function that returns the starting state.
+         * @return uint32_t - The index of the starting state.
+         */
+        uint32_t startState() const { return mStartState; }
+
+        /**
+         * A function that returns the number of states.
+         * @return size_t - The number of states.
+         */
+        size_t stateCount() const { return mTokens.size(); }
+
+        /**
+         * A function that returns the state reached from 'state' with 'character'.
+         * @param state - uint32_t - The current state.
+         * @param character - unsigned char - The read character.
+         * @return uint32_t - The next state or DeadState if there is no transition.
+         */
+        uint32_t next(uint32_t state, unsigned char character) const { return mTransitions[state * 256 + character]; }
+
+        /**
+         * A function that returns the token accepted by a state.
+         * @param state - uint32_t - The state.
+         * @return int - The token id or -1 if the state is not accepting.
+         */
+        int token(uint32_t state) const { return mTokens[state]; }
+
+        /**
+         * A function that returns the number of token types.
+         * @return size_t - The number of token types.
+         */
+        size_t tokenCount() const { return mTokenTypes.size(); }
+
+        /**
+         * A function that returns the type of a token id.
+         * @param token - int - The token id.
+         * @return std::string - The token type.
+         */
+        const std::string& tokenType(int token) const { return mTokenTypes.at(token); }
+
+        /**
+         * A function that returns the id of a token type.
+         * @param type - std::string - The token type.
+         * @return int - The token id or -1 if the lexic does not contain this type.
+         */
+        int tokenId(const std::string& type) const;
+
+        /**
+         * A function that runs the DFA from 'begin' and returns the longest accepted prefix.
+         * @param begin - const char* - The start of the token.
+         * @param end - const char* - The end of the input.
+         * @return Match - The longest match.
+         */
+        Match match(const char* begin, const char* end) const;
+
+        /**
+         * A function that computes the minimal DFA recognizing the same tokens.
+         * Equivalent states (same token and same transitions up to equivalence) are merged.
+         * @return DFATable - The minimized table, sharing the token ids of this table.
+         */
+        DFATable minimized() const;
+
+    private:
+        /**
+         * A default constructor.
+         * Constructs an empty table.
+         */
+        DFATable();
+
+        std::vector<uint32_t> mTransitions;         //< The dense transition table.
+        std::vector<int> mTokens;                   //< The token accepted by each state (or -1).
+        std::vector<std::string> mTokenTypes;       //< The token types, indexed by token id.
+        uint32_t mStartState;                       //< The starting state.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef __INPUT_CHANNEL_HPP__
+#define __INPUT_CHANNEL_HPP__
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <deque>
+#include <string>
+
+/**
+ * The InputChannel class. A source of input chunks awaited by a coroutine (see Lexer::lexAsync).
+ * The producer (a network callback for example) pushes the chunks as they arrive, which resumes the
+ * waiting coroutine on the producer thread. A channel has a single reader.
+ */
+class InputChannel {
+    public:
+        /**
+         * The awaiter returned by read().
+         */
+        class Read {
+            public:
+                Read(InputChannel& channel) : mChannel(channel) {}
+
+                bool await_ready() const noexcept { return !mChannel.mChunks.empty() || mChannel.mClosed; }
+                void await_suspend(std::coroutine_handle<> reader) noexcept { mChannel.mReader = reader; }
+
+                /**
+                 * Returns the next chunk.
+                 * @return std::string - The chunk, or an empty string if the channel is closed.
+                 */
+                std::string await_resume();
+
+            private:
+                InputChannel& mChannel; //< The channel.
+        };
+
+        /**
+         * A constructor.
+         * Constructs an open channel.
+         */
+        InputChannel();
+
+        /**
+         * A function that returns an awaitable on the next chunk.
+         * @return Read - The awaitable.
+         */
+        Read read() { return Read(*this); }
+
+        /**
+         * Adds a chunk of input, resuming the reader if it waits for one.
+         * @param chunk - std::string - The chunk (ignored if empty).
+         */
+        void push(std::string chunk);
+
+        /**
+         * Marks the end of the input, resuming the reader if it waits for a chunk.
+         */
+        void close();
+
+    private:
+        std::deque<std::string> mChunks;    //< The chunks not read yet.
+        bool mClosed;                       //< A boolean indicating if the input has ended.
+        std::coroutine_handle<> mReader;    //< The coroutine waiting for a chunk, if any.
+
+        /**
+         * Resumes the coroutine waiting for a chunk, if any.
+         */
+        void wakeReader();
+};
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef __JIT_SCANNER_HPP__
+#define __JIT_SCANNER_HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include "DFATable.hpp"
+
+/**
+ * The JITScanner class. Translates a DFATable into native x86-64 code.
+ * Each state becomes a basic block that reads a character and jumps to the next state through a
+ * compare/jump tree, the positions living in registers. On other architectures (or if the executable
+ * memory can't be allocated), the scanner falls back to the table.
+ */
+class JITScanner {
+    public:
+        /**
+         * A constructor.
+         * Compiles the given table. The table must outlive the scanner.
+         * @param table - DFATable - The DFA to compile.
+         */
+        JITScanner(const DFATable& table);
+
+        /**
+         * A destructor.
+         * Releases the executable memory.
+         */
+        ~JITScanner();
+
+        JITScanner(const JITScanner& other) = delete;
+        JITScanner& operator=(const JITScanner& other) = delete;
+
+        /**
+         * A function that indicates if native code is used.
+         * @return bool - True if the DFA has been compiled, false if the table is used.
+         */
+        bool isCompiled() const { return mFunction != nullptr; }
+
+        /**
+         * A function that runs the DFA from 'begin' and returns the longest accepted prefix.
+         * @param begin - const char* - The start of the token.
+         * @param end - const char* - The end of the input.
+         * @return Match - The longest match.
+         */
+        Match match(const char* begin, const char* end) const;
+
+    private:
+        using ScanFunction = void (*)(const char*, const char*, Match*);
+
+        DFATable mTable;            //< A copy of the compiled table, also used as a fallback.
+        void* mCode;                //< The executable memory.
+        size_t mCodeSize;           //< The size of the executable memory.
+        ScanFunction mFunction;     //< The entry point of the compiled code.
+
+        /**
+         * A function that generates the machine code of the DFA.
+         * @return std::vector<uint8_t> - The machine code.
+         */
+        std::vector<uint8_t> generate() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef __KEYWORDINFO_HPP__
+#define __KEYWORDINFO_HPP__
+
+#include <string>
+
+/**
+ * KeywordInfo structure.
+ * Represents a keyword: a lexeme of a generic token type (an identifier for example) that is reclassified
+ * into its own token type after the match, instead of having its own path in the DFA.
+ */
+struct KeywordInfo {
+    std::string text;       //< The lexeme of the keyword.
+    std::string type;       //< The token type of the keyword.
+    std::string baseType;   //< The token type matched by the DFA for this lexeme.
+};
+
+#endif
\ No newline at end of file
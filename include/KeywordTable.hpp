@@ -0,0 +1,87 @@
+#ifndef __KEYWORD_TABLE_HPP__
+#define __KEYWORD_TABLE_HPP__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DFATable.hpp"
+#include "KeywordInfo.hpp"
+
+/**
+ * The KeywordTable class. Reclassifies the tokens whose lexeme is a keyword of their token type.
+ * The keywords are placed with a perfect hash (hash and displace), so reclassifying a token costs one hash
+ * of its lexeme and one comparison, whatever the number of keywords.
+ */
+class KeywordTable {
+    public:
+        /**
+         * A constructor.
+         * Constructs a table without keywords.
+         */
+        KeywordTable();
+
+        /**
+         * A constructor.
+         * Constructs the perfect hash of the keywords of a lexic.
+         * @param keywords - std::vector<KeywordInfo> - The keywords.
+         * @param table - DFATable - The DFA of the lexic, giving the token ids.
+         */
+        KeywordTable(const std::vector<KeywordInfo>& keywords, const DFATable& table);
+
+        /**
+         * A function that indicates if there are keywords.
+         * @return bool - True if there are no keywords.
+         */
+        bool empty() const { return mEntries.empty(); }
+
+        /**
+         * A function that returns the token id of a match, taking the keywords into account.
+         * @param token - int - The token id matched by the DFA.
+         * @param begin - const char* - The first character of the token.
+         * @param length - size_t - The length of the token.
+         * @return int - The token id of the keyword, or 'token' if the lexeme isn't a keyword.
+         */
+        int classify(int token, const char* begin, size_t length) const {
+            if (token < 0 || static_cast<size_t>(token) >= mIsBase.size() || !mIsBase[token]) {
+                return token;
+            }
+            return lookup(token, begin, length);
+        }
+
+    private:
+        /**
+         * A slot of the hash table.
+         */
+        struct Entry {
+            std::string text;   //< The lexeme of the keyword.
+            int baseToken;      //< The token id matched by the DFA.
+            int token;          //< The token id of the keyword, -1 if the slot is empty.
+        };
+
+        std::vector<char> mIsBase;              //< Indicates, for each token id, if it has keywords.
+        std::vector<uint32_t> mDisplacements;   //< The displacement of each bucket.
+        std::vector<Entry> mEntries;            //< The slots (a power of two).
+        uint64_t mSeed;                         //< The seed of the hash function.
+
+        /**
+         * A function that looks a lexeme up in the table.
+         * @param token - int - The token id matched by the DFA.
+         * @param begin - const char* - The first character of the token.
+         * @param length - size_t - The length of the token.
+         * @return int - The token id of the keyword, or 'token' if the lexeme isn't a keyword.
+         */
+        int lookup(int token, const char* begin, size_t length) const;
+
+        /**
+         * A function that hashes a lexeme and its token id.
+         * @param seed - uint64_t - The seed.
+         * @param token - int - The token id matched by the DFA.
+         * @param begin - const char* - The first character of the token.
+         * @param length - size_t - The length of the token.
+         * @return uint64_t - The hash.
+         */
+        static uint64_t hash(uint64_t seed, int token, const char* begin, size_t length);
+};
+
+#endif
\ No newline at end of file
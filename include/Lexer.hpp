@@ -3,20 +3,62 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <functional>
 
 #include "NFA.hpp"
 #include "Traverser.hpp"
+#include "DFATable.hpp"
+#include "JITScanner.hpp"
+#include "ThreadedScanner.hpp"
+#include "ShuffleScanner.hpp"
+#include "Token.hpp"
+#include "TokenStatistics.hpp"
+#include "TokenBuffer.hpp"
+#include "NumericToken.hpp"
+#include "SymbolToken.hpp"
+#include "SymbolTable.hpp"
+#include "TokenRange.hpp"
+#include "TokenSink.hpp"
+#include "TokenActions.hpp"
+#include "TokenGenerator.hpp"
+#include "InputChannel.hpp"
+#include "SyncAnalysis.hpp"
+#include "KeywordTable.hpp"
+#include "TextEdit.hpp"
+#include "SegmentedInput.hpp"
+#include "CheckpointIndex.hpp"
 
 /**
  * A lexer class. Represent a lexer.
  */
 class Lexer {
     public:
+        static constexpr size_t BatchLanes = 8;    //< The number of inputs lexed together by the batch API.
+        static constexpr int ErrorToken = -1;       //< The token id of the invalid parts of an input.
+        static inline const std::string ErrorType = "ERROR";   //< The token type of the invalid parts of an input.
+
+        /**
+         * The engines that can be used to run the DFA in extractTokens.
+         */
+        enum class Engine {
+            Traverser,  //< Walks the NFA transition map with a Traverser.
+            Table,      //< Uses a dense transition table.
+            Threaded,   //< Uses a threaded interpreter over the dense transition table.
+            JIT,        //< Uses native code generated from the table (falls back to Table if unavailable).
+            Shuffle,    //< Uses SIMD shuffles, for DFAs of at most 16 states (falls back to Threaded otherwise).
+            Auto        //< Uses Shuffle when possible, Threaded otherwise.
+        };
+
         /**
          * A constructor.
          * Constructs a lexer from a NFA representing the detected lexic.
+         * The Traverser engine walks the given NFA as is, so it must be a DFA (see NFA::isDeterministic).
+         * The table based engines run the minimized DFA, the NFA being determinized first if it isn't a DFA.
+         * @param nfa - NFA - The NFA (usually the DFA) of the lexic.
+         * @param engine - Engine - The engine used by extractTokens.
          */
-        Lexer(const NFA& nfa);
+        Lexer(const NFA& nfa, Engine engine = Engine::Auto);
 
         /**
          * A function that extracts token from the given input and returns a list of tokens.
@@ -25,6 +67,232 @@ class Lexer {
          */
         std::vector<std::pair<std::string, std::string>> extractTokens(const std::string& input);
 
+        /**
+         * A function that extracts the tokens of several independent inputs.
+         * The inputs are lexed in lock-step, interleaving the transitions of BatchLanes inputs so that
+         * their table loads overlap. The lanes step the dense transition table one character at a time,
+         * so the engine of the lexer doesn't apply (the tokens are the same whatever the engine).
+         * @param inputs a std::vector<std::string> representing the input texts.
+         * @return std::vector<std::vector<std::pair<std::string, std::string>>> - The list of tokens of each input.
+         */
+        std::vector<std::vector<std::pair<std::string, std::string>>> extractTokens(const std::vector<std::string>& inputs) const;
+
+        /**
+         * A function that extracts the tokens of the given input as spans of the input.
+         * @param input a std::string representing the input text.
+         * @return std::vector<Token> - The list of tokens.
+         */
+        std::vector<Token> tokenize(const std::string& input) const;
+
+        /**
+         * A function that checks that the given input is lexically valid, without producing the tokens.
+         * @param input a std::string representing the input text.
+         * @return std::pair<bool, size_t> - True if the input is valid, and the offset of the first invalid
+         * token otherwise (the length of the input if it is valid).
+         */
+        std::pair<bool, size_t> validate(const std::string& input) const;
+
+        /**
+         * A function that counts the tokens of each type in the given input, without producing the tokens.
+         * @param input a std::string representing the input text.
+         * @param histograms a boolean indicating if the length histograms are computed.
+         * @return TokenStatistics - The number of tokens (and their lengths) of each token id.
+         */
+        TokenStatistics count(const std::string& input, bool histograms = false) const;
+
+        /**
+         * A function that extracts the tokens of the given input without stopping at lexical errors.
+         * An invalid part of the input is emitted as an ErrorToken covering its first character and the
+         * following ones that can't start a token, then the lexing resumes. Nothing is thrown.
+         * @param input a std::string representing the input text.
+         * @param onError a callable receiving each error token (optional).
+         * @return std::vector<Token> - The list of tokens, error tokens included.
+         */
+        std::vector<Token> tokenizeWithRecovery(const std::string& input,
+                                                const std::function<void(const Token&)>& onError = nullptr) const;
+
+        /**
+         * A function that extracts the tokens of the given input and builds a checkpoint index of it.
+         * @param input a std::string representing the input text.
+         * @param index a CheckpointIndex filled with the checkpoints of the input.
+         * @return std::vector<Token> - The list of tokens.
+         */
+        std::vector<Token> tokenize(const std::string& input, CheckpointIndex& index) const;
+
+        /**
+         * A function that extracts a range of tokens, lexing from the closest checkpoint.
+         * @param input a std::string representing the input text (the one that was indexed).
+         * @param index a CheckpointIndex of the input.
+         * @param first the index of the first token.
+         * @param last the index following the last token.
+         * @return std::vector<Token> - The tokens of the range.
+         */
+        std::vector<Token> tokenizeRange(const std::string& input, const CheckpointIndex& index, size_t first, size_t last) const;
+
+        /**
+         * A function that extracts the tokens overlapping a range of bytes, lexing from the closest checkpoint.
+         * @param input a std::string representing the input text (the one that was indexed).
+         * @param index a CheckpointIndex of the input.
+         * @param begin the offset of the first byte.
+         * @param end the offset following the last byte.
+         * @return std::vector<Token> - The tokens overlapping the range.
+         */
+        std::vector<Token> tokenizeBytes(const std::string& input, const CheckpointIndex& index, size_t begin, size_t end) const;
+
+        /**
+         * A function that extracts the tokens overlapping a range of bytes, without an index.
+         * The lexing starts from the nearest position before 'begin' where the lexing of the whole input looks
+         * for a token (see SyncAnalysis::findTokenStart), found from the sync points and the convergence of the runs.
+         * @param input a std::string representing the input text.
+         * @param begin the offset of the first byte.
+         * @param end the offset following the last byte.
+         * @return std::vector<Token> - The tokens overlapping the range.
+         */
+        std::vector<Token> tokenizeBytes(const std::string& input, size_t begin, size_t end) const;
+
+        /**
+         * A function that extracts the tokens of the given input and converts the numeric ones.
+         * Each number is converted as soon as it is matched, while its characters are still in cache,
+         * instead of in a second pass over the tokens.
+         * @param input a std::string representing the input text.
+         * @param integerType the token type of the integers (see NumberParser::parseInteger).
+         * @param floatType the token type of the floats (see NumberParser::parseFloat).
+         * @return std::vector<NumericToken> - The list of tokens and their values.
+         */
+        std::vector<NumericToken> tokenizeNumbers(const std::string& input, const std::string& integerType = "NUM",
+                                                  const std::string& floatType = "FLOAT") const;
+
+        /**
+         * A function that extracts the tokens of the given input and interns the identifiers.
+         * The identifiers are interned as soon as they are matched. The table can be shared by several calls,
+         * even concurrent ones, and the input is lexed on several threads if asked (see tokenize).
+         * @param input a std::string representing the input text.
+         * @param symbols the SymbolTable receiving the identifiers.
+         * @param threadCount the number of threads to use (0 to use the number of hardware threads).
+         * @param identifierType the token type of the identifiers.
+         * @return std::vector<SymbolToken> - The list of tokens and the symbol ids of the identifiers.
+         */
+        std::vector<SymbolToken> tokenizeSymbols(const std::string& input, SymbolTable& symbols, size_t threadCount = 1,
+                                                 const std::string& identifierType = "IDENTIFIER") const;
+
+        /**
+         * A function that appends the tokens of the given input to a buffer.
+         * The buffer isn't cleared, so that it can be cleared and reused by the caller without reallocation.
+         * @param input a std::string representing the input text.
+         * @param buffer a TokenBuffer receiving the tokens.
+         */
+        void tokenize(const std::string& input, TokenBuffer& buffer) const;
+
+        /**
+         * A function that pushes the tokens of the given input to a sink, directly from the scan loop.
+         * The sink is either a callable or an object with an onToken member, both receiving the token id and
+         * the characters of the token as (int, const char*, const char*). If the sink has an
+         * onError(const char*, const char*) member, the invalid parts of the input are passed to it and the
+         * lexing continues (see tokenizeWithRecovery), otherwise a LexicalErrorException is thrown.
+         * As this is a template, the calls to the sink are inlined.
+         * @param input a std::string representing the input text.
+         * @param sink the sink receiving the tokens.
+         */
+        template <typename Sink>
+        void lex(const std::string& input, Sink&& sink) const;
+
+        /**
+         * A function that returns a range lazily extracting the tokens of the given input.
+         * @param input a std::string representing the input text (it must outlive the range).
+         * @return TokenRange - The range of the tokens.
+         */
+        TokenRange tokens(const std::string& input) const { return TokenRange(*this, input); }
+
+#if defined(__cpp_impl_coroutine)
+        /**
+         * A function that returns a coroutine generating the tokens of the given input.
+         * @param input a std::string representing the input text (it must outlive the generator).
+         * @return TokenGenerator - The generator of the tokens.
+         */
+        TokenGenerator generate(const std::string& input) const;
+
+        /**
+         * A function that returns a coroutine lexing a stream whose chunks are awaited from a channel.
+         * When the lexing needs more input, it waits for the next chunk without blocking the thread, then
+         * continues the pending token. A token is yielded once the DFA can't extend it anymore.
+         * @param source an InputChannel providing the chunks of the stream (it must outlive the generator).
+         * @return AsyncTokenGenerator - The generator of the tokens.
+         */
+        AsyncTokenGenerator lexAsync(InputChannel& source) const;
+#endif
+
+        /**
+         * A function that extracts the tokens of a segmented input without flattening it.
+         * The DFA keeps its state across the segment edges, tokens crossing them are reported as spans
+         * of the whole text (their characters can be copied with SegmentedInput::substr).
+         * @param input a SegmentedInput representing the input text.
+         * @return std::vector<Token> - The list of tokens.
+         */
+        std::vector<Token> tokenize(const SegmentedInput& input) const;
+
+        /**
+         * A function that extracts the tokens of a large input using several threads.
+         * When the lexic has sync characters (see SyncAnalysis), the input is cut at sync points in roughly
+         * equal chunks that are lexed concurrently. Otherwise, the chunks are lexed speculatively
+         * (see tokenizeSpeculative).
+         * @param input a std::string representing the input text.
+         * @param threadCount the number of threads to use (0 to use the number of hardware threads).
+         * @return std::vector<Token> - The list of tokens.
+         */
+        std::vector<Token> tokenize(const std::string& input, size_t threadCount) const;
+
+        /**
+         * A function that extracts the tokens of a large input using several threads, whatever the lexic.
+         * Each chunk is lexed concurrently assuming a token starts at its beginning. The chunks are then
+         * stitched in order: the end of the previous chunk is re-lexed until it reaches a position where
+         * the speculation of the chunk looked for a token, from which the speculated tokens are kept.
+         * When the runs of the lexer converge (see SyncAnalysis::convergenceLength), each chunk is lexed from
+         * that many characters before it, so that its speculation already agrees with the real lexing.
+         * @param input a std::string representing the input text.
+         * @param threadCount the number of threads to use (0 to use the number of hardware threads).
+         * @return std::vector<Token> - The list of tokens.
+         */
+        std::vector<Token> tokenizeSpeculative(const std::string& input, size_t threadCount) const;
+
+        /**
+         * A function that updates the tokens of an input after it has been edited.
+         * Only the part of the input around the edit is lexed again: from the first token that could have
+         * read the edited characters, until the lexing reaches a position where the previous lexing was
+         * also looking for a token. The following tokens are kept and shifted.
+         * @param tokens the tokens of the input before the edit, updated in place.
+         * @param input a std::string representing the input text after the edit.
+         * @param edit the edit applied to the input.
+         */
+        void relex(std::vector<Token>& tokens, const std::string& input, const TextEdit& edit) const;
+
+        /**
+         * A function that extracts token from the given input using several threads (see tokenize).
+         * @param input a std::string representing the input text.
+         * @param threadCount the number of threads to use (0 to use the number of hardware threads).
+         * @return std::vector<std::pair<std::string, std::string>> - The list of pair of tokens and their types.
+         */
+        std::vector<std::pair<std::string, std::string>> extractTokens(const std::string& input, size_t threadCount) const;
+
+        /**
+         * A function that returns the type of a token id.
+         * @param type - int - The token id (or ErrorToken).
+         * @return std::string - The token type.
+         */
+        const std::string& tokenType(int type) const { return (type == ErrorToken) ? ErrorType : mTable.tokenType(type); }
+
+        /**
+         * A function that returns the number of token types.
+         * @return size_t - The number of token ids.
+         */
+        size_t tokenCount() const { return mTable.tokenCount(); }
+
+        /**
+         * A function that returns the id of a token type.
+         * @param type - std::string - The token type.
+         * @return int - The token id or -1 if the lexic does not contain this type.
+         */
+        int tokenId(const std::string& type) const { return mTable.tokenId(type); }
+
         /**
          * A function that extracts the next token from the input.
          * @param stream a std::string representing the input text.
@@ -33,8 +301,28 @@ class Lexer {
          */
         std::pair<bool, std::pair<std::string, std::string>> next(const std::string& stream);
 
+        /**
+         * A function that returns the analysis of the places where the lexer restarts whatever the history.
+         * @return SyncAnalysis - The analysis of the lexic.
+         */
+        const SyncAnalysis& syncAnalysis() const { return mSyncAnalysis; }
+
+        /**
+         * A function that returns the engine used by extractTokens.
+         * Auto and unavailable engines are resolved to the engine actually used.
+         * @return Engine - The engine.
+         */
+        Engine engine() const { return mEngine; }
+
     private:
         Traverser mTraverser;       //< A helper class that traverse the nfa graph.
+        DFATable mTable;            //< The dense table of the minimized DFA.
+        Engine mEngine;             //< The engine used by extractTokens.
+        ThreadedScanner mThreadedScanner;           //< The threaded interpreter.
+        std::unique_ptr<JITScanner> mJITScanner;    //< The native scanner, if the JIT engine is used.
+        std::unique_ptr<ShuffleScanner> mShuffleScanner;    //< The SIMD scanner, if the Shuffle engine is used.
+        SyncAnalysis mSyncAnalysis;                 //< The places where the lexer restarts whatever the history.
+        KeywordTable mKeywords;                     //< The keywords of the lexic, reclassified after the match.
         State mLastValidState;      //< The last detected valid state.
         bool mHasLastValidState;    //< A boolean indicating if the lexer has found a valid state.
         size_t mLastStartPosition;  //< An index representing the position where to restart after having returned a token.
@@ -48,6 +336,104 @@ class Lexer {
          * @return std::pair<std::string, std::string> - The token and its type.
          */
         std::pair<std::string, std::string> getLastToken(const std::string& input);
+
+        /**
+         * A function that extracts the first token after a position.
+         * @param input a std::string representing the input text.
+         * @param position the position where the token is looked for.
+         * @return std::pair<bool, Token> - True and the token, or false if there are no more tokens.
+         */
+        std::pair<bool, Token> nextToken(const std::string& input, size_t position) const;
+
+        /**
+         * A function that finds where the lexing resumes after an invalid token: the next character that
+         * starts a token or is a separator.
+         * @param input a std::string representing the input text.
+         * @param startPosition the position of the invalid token.
+         * @return size_t - The position where the lexing resumes.
+         */
+        size_t resynchronize(const std::string& input, size_t startPosition) const;
+
+        /**
+         * A function that throws the error of an invalid token.
+         * @param input a std::string representing the input text.
+         * @param startPosition the position of the invalid token.
+         * @param scanned the number of characters read by the DFA before it stopped.
+         */
+        [[noreturn]] void throwUnknownToken(const std::string& input, size_t startPosition, size_t scanned) const;
+
+        /**
+         * A function that runs the selected engine from 'begin' and returns the longest accepted prefix.
+         * The keywords are reclassified into their token ids.
+         * @param begin - const char* - The start of the token.
+         * @param end - const char* - The end of the input.
+         * @return Match - The longest match.
+         */
+        Match match(const char* begin, const char* end) const;
+
+        /**
+         * A function that splits a part of the input in tokens using the selected engine.
+         * @param input a std::string representing the input text.
+         * @param from the position where the lexing starts.
+         * @param to the position where the lexing ends.
+         * @param emit a callable receiving the start, the length and the token id of each token.
+         */
+        template <typename Emit>
+        void scan(const std::string& input, size_t from, size_t to, Emit&& emit) const;
+
+        /**
+         * A function that extracts a single token using the selected engine.
+         * @param input a std::string representing the input text.
+         * @param startPosition the position where the token starts.
+         * @param to the position where the lexing ends.
+         * @param emit a callable receiving the start, the length and the token id of the token.
+         * @return size_t - The position where the next token starts.
+         */
+        template <typename Emit>
+        size_t scanToken(const std::string& input, size_t startPosition, size_t to, Emit&& emit) const;
+
+        /**
+         * A function that lexes chunks of the input cut at separators on several threads.
+         * @param input a std::string representing the input text.
+         * @param threadCount the number of threads to use (0 to use the number of hardware threads).
+         * @param makeToken a callable converting the start, the length and the token id of a token to a T.
+         * @return std::vector<T> - The list of tokens.
+         */
+        template <typename T, typename MakeToken>
+        std::vector<T> parallelScan(const std::string& input, size_t threadCount, MakeToken makeToken) const;
+
+    friend class TokenRange;
 };
 
+template <typename Sink>
+void Lexer::lex(const std::string& input, Sink&& sink) const {
+    using SinkType = std::remove_reference_t<Sink>;
+    const char* data = input.data();
+    size_t startPosition = 0;
+
+    while (startPosition < input.length()) {
+        Match m = match(data + startPosition, data + input.length());
+
+        if (m.token >= 0) {
+            const char* begin = data + startPosition;
+            if constexpr (HasOnToken<SinkType>::value) {
+                sink.onToken(m.token, begin, begin + m.length);
+            } else {
+                sink(m.token, begin, begin + m.length);
+            }
+            startPosition += m.length;
+        } else if (m.scanned == 0 && (data[startPosition] == ' ' || data[startPosition] == '\n')) {
+            startPosition++;
+        } else {
+            if constexpr (HasOnError<SinkType>::value) {
+                size_t position = resynchronize(input, startPosition);
+                sink.onError(data + startPosition, data + position);
+                startPosition = position;
+            } else {
+                throwUnknownToken(input, startPosition, m.scanned);
+            }
+        }
+    }
+}
+
 #endif
\ No newline at end of file
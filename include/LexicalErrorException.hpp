@@ -1,7 +1,12 @@
 #ifndef __LEXICAL_ERROR_EXCEPTION_HPP__
 #define __LEXICAL_ERROR_EXCEPTION_HPP__
 
+#include <cstdint>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "LineIndex.hpp"
 
 /**
  * An exception class. Thrown when a lexical error has been detected.
@@ -13,6 +18,38 @@ class LexicalErrorException : public std::runtime_error {
          * Constructs the error with the given message.
          */
         LexicalErrorException(const std::string& msg = "");
+
+        /**
+         * A constructor.
+         * Constructs the error with the given message and the offset of the unknown token.
+         */
+        LexicalErrorException(const std::string& msg, size_t offset);
+
+        /**
+         * A function that builds the error of an unknown token.
+         * Only the offset is stored, the line and column are computed on request (see position).
+         * @param unknownToken - std::string_view - The characters of the unknown token.
+         * @param offset - size_t - The offset of the unknown token in the input.
+         * @return LexicalErrorException - The error.
+         */
+        static LexicalErrorException unknownToken(std::string_view unknownToken, size_t offset);
+
+        /**
+         * A function that returns the offset of the unknown token in the input.
+         * @return size_t - The offset, or SIZE_MAX if it is unknown.
+         */
+        size_t offset() const { return mOffset; }
+
+        /**
+         * A function that computes the line and column of the unknown token.
+         * The newlines of the input are only indexed up to the token, when this function is called.
+         * @param input - std::string_view - The input in which the error was detected.
+         * @return LineIndex::Position - The position of the token, or {0, 0} if its offset is unknown.
+         */
+        LineIndex::Position position(std::string_view input) const;
+
+    private:
+        size_t mOffset; //< The offset of the unknown token.
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef __LINE_INDEX_HPP__
+#define __LINE_INDEX_HPP__
+
+#include <string_view>
+#include <vector>
+
+/**
+ * The LineIndex class. Maps offsets of a text to lines and columns.
+ * The tokens only carry offsets, so the lexing loop doesn't count lines. The newlines are found afterwards,
+ * on request, with a vectorized scan, and the offsets are then mapped by binary search.
+ */
+class LineIndex {
+    public:
+        /**
+         * A position in a text.
+         */
+        struct Position {
+            size_t line;    //< The line, starting from 1.
+            size_t column;  //< The column (in bytes), starting from 1.
+        };
+
+        /**
+         * A constructor.
+         * Constructs the index of an empty text.
+         */
+        LineIndex();
+
+        /**
+         * A constructor.
+         * Constructs the index of a text.
+         * @param text - std::string_view - The text.
+         */
+        LineIndex(std::string_view text);
+
+        /**
+         * Adds a part of the text at the end of the index, so that a text read in parts is indexed without
+         * being flattened (the constructor appends the whole text).
+         * @param text - std::string_view - The following part of the text.
+         */
+        void append(std::string_view text);
+
+        /**
+         * A function that maps an offset to its line and column.
+         * @param offset - size_t - The offset in the text.
+         * @return Position - The position of the offset.
+         */
+        Position position(size_t offset) const;
+
+        /**
+         * A function that returns the offset of the first character of a line.
+         * @param line - size_t - The line, starting from 1.
+         * @return size_t - The offset of the line.
+         */
+        size_t lineOffset(size_t line) const;
+
+        /**
+         * A function that returns the number of lines of the text.
+         * @return size_t - The number of lines (a text without newline has one line).
+         */
+        size_t lineCount() const { return mNewlines.size() + 1; }
+
+    private:
+        std::vector<size_t> mNewlines;  //< The offsets of the newlines, in order.
+        size_t mLength;                 //< The length of the indexed text.
+};
+
+#endif
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <cassert>
 
 #include "State.hpp"
+#include "KeywordInfo.hpp"
 
 using Alphabet = std::string;
 using CharType = Alphabet::value_type;
@@ -133,6 +134,25 @@ class NFA {
          */
         void addTransitions(const std::string& from, const Alphabet& characters, const std::string& to);
 
+        /**
+         * Adds a keyword, recognized by the DFA as its base token type then reclassified (see KeywordTable).
+         * The keywords are kept by toDFA and combine.
+         * @param keyword The keyword.
+         */
+        void addKeyword(const KeywordInfo& keyword);
+
+        /**
+         * A function that returns the keywords of the lexic.
+         * @return a std::vector<KeywordInfo> representing the keywords.
+         */
+        const std::vector<KeywordInfo>& keywords() const { return mKeywords; }
+
+        /**
+         * A function that indicates if the NFA is a DFA.
+         * @return bool - True if it has a single starting state and no empty transition.
+         */
+        bool isDeterministic() const;
+
         /**
          * Print the NFA in the console.
          * This is a debug function.
@@ -145,6 +165,15 @@ class NFA {
          */
         NFA toDFA() const;
 
+        /**
+         * Builds the NFA of the reversed token language.
+         * All the transitions are reversed, a new starting state leads to the former accepting states
+         * and the former starting states become accepting (with a TOKEN_START payload). Converted to a
+         * DFA, it reads a token backwards from its end.
+         * @return NFA - the reversed NFA.
+         */
+        NFA reverse() const;
+
         /**
          * Combines multiple NFAs to a single NFA
          * 
@@ -154,6 +183,7 @@ class NFA {
         static NFA combine(const std::vector<NFA>& nfas);
 
         friend class Traverser;
+        friend class TrieBuilder;
 
     private:
         Alphabet mAlphabet;
@@ -161,6 +191,7 @@ class NFA {
         std::map<std::pair<size_t, CharType>, size_t> mCharacterTransitionTable;
         std::map<size_t, std::vector<size_t>> mEmptyTransitionTable;
         std::vector<State> mStates;
+        std::vector<KeywordInfo> mKeywords;
 
         bool exists(const State& state);
         std::set<size_t> findReachableStates(const std::set<size_t>& startingState,
@@ -175,6 +206,7 @@ class NFA {
         std::set<size_t> computeStartingState() const;
     
     friend class NFAIO;
+    friend class DFATable;
 };
 
 #endif
\ No newline at end of file
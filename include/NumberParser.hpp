@@ -0,0 +1,31 @@
+#ifndef __NUMBER_PARSER_HPP__
+#define __NUMBER_PARSER_HPP__
+
+#include <cstdint>
+#include <utility>
+
+/**
+ * A helper class. Used to convert the numeric lexemes (as accepted by num_lexic.json and float_lexic.json).
+ */
+class NumberParser {
+    public:
+        /**
+         * A function that converts a decimal integer.
+         * @param begin - const char* - The first digit.
+         * @param end - const char* - The character following the last digit.
+         * @return std::pair<bool, uint64_t> - True and the value, or false if it doesn't fit in 64 bits.
+         */
+        static std::pair<bool, uint64_t> parseInteger(const char* begin, const char* end);
+
+        /**
+         * A function that converts a decimal float ("1.5", ".5", "1.", "3e-2", ...) with correct rounding.
+         * The digits are read once: the value is computed exactly from the mantissa and the exponent when they
+         * are small enough (Clinger's fast path), the other values are converted by the standard library.
+         * @param begin - const char* - The first character.
+         * @param end - const char* - The character following the last one.
+         * @return std::pair<bool, double> - True and the value, or false if it has no digit or is out of range.
+         */
+        static std::pair<bool, double> parseFloat(const char* begin, const char* end);
+};
+
+#endif
\ No newline at end of file
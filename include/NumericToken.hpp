@@ -0,0 +1,28 @@
+#ifndef __NUMERIC_TOKEN_HPP__
+#define __NUMERIC_TOKEN_HPP__
+
+#include <cstdint>
+
+#include "Token.hpp"
+
+/**
+ * NumericToken structure.
+ * Represents a token with the value of its lexeme when it is a number (see Lexer::tokenizeNumbers).
+ */
+struct NumericToken {
+    /**
+     * The kinds of values.
+     */
+    enum class Kind {
+        None,       //< The token isn't a number (or its value is out of range).
+        Integer,    //< The value is in 'integer'.
+        Float       //< The value is in 'real'.
+    };
+
+    Token token;        //< The token.
+    Kind kind;          //< The kind of value.
+    uint64_t integer;   //< The value of an integer token.
+    double real;        //< The value of a float token.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef __REVERSE_SCANNER_HPP__
+#define __REVERSE_SCANNER_HPP__
+
+#include <string>
+
+#include "NFA.hpp"
+#include "DFATable.hpp"
+#include "SyncAnalysis.hpp"
+
+/**
+ * The ReverseScanner class. Finds token boundaries by scanning an input backwards.
+ * It runs the DFA of the reversed token language (see NFA::reverse) to know if a token ends at a
+ * position. Random-access consumers find a restart point with findTokenStart, without lexing from the beginning.
+ */
+class ReverseScanner {
+    public:
+        /**
+         * A constructor.
+         * Builds the forward and reversed tables of a lexic.
+         * @param dfa - NFA - The DFA of the lexic.
+         */
+        ReverseScanner(const NFA& dfa);
+
+        /**
+         * A function that indicates if a token ends right before a position.
+         * @param input - std::string - The input text.
+         * @param position - size_t - The position.
+         * @return bool - True if input[start, position) is a token for some start.
+         */
+        bool isTokenEnd(const std::string& input, size_t position) const;
+
+        /**
+         * A function that finds the nearest position, at or before 'offset', where the lexing of the whole input
+         * looks for a token. A position where a token ends isn't enough (inside an identifier, almost every
+         * position is one), so the position is confirmed by lexing forward (see SyncAnalysis::findTokenStart).
+         * @param input - std::string - The input text.
+         * @param offset - size_t - The position to start from.
+         * @return size_t - The position where the lexing looks for a token.
+         */
+        size_t findTokenStart(const std::string& input, size_t offset) const;
+
+    private:
+        DFATable mTable;            //< The table of the lexic.
+        DFATable mReverseTable;     //< The table of the reversed lexic.
+        SyncAnalysis mSyncAnalysis; //< The sync characters of the lexic.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef __SEGMENTED_INPUT_HPP__
+#define __SEGMENTED_INPUT_HPP__
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * The SegmentedInput class. Represents a text made of several contiguous segments.
+ * It references the segments of a rope, a piece table or an iovec array without copying them, so the
+ * segments must outlive it. Offsets are given in the whole text.
+ */
+class SegmentedInput {
+    public:
+        /**
+         * A constructor.
+         * Constructs an empty input.
+         */
+        SegmentedInput();
+
+        /**
+         * A constructor.
+         * Constructs an input from a list of segments.
+         * @param segments - std::vector<std::string_view> - The segments, in order.
+         */
+        SegmentedInput(const std::vector<std::string_view>& segments);
+
+        /**
+         * Adds a segment at the end of the input.
+         * @param segment - std::string_view - The segment.
+         */
+        void append(std::string_view segment);
+
+        /**
+         * A function that returns the length of the whole text.
+         * @return size_t - The number of characters.
+         */
+        size_t length() const { return mLength; }
+
+        /**
+         * A function that returns the number of segments.
+         * @return size_t - The number of (non empty) segments.
+         */
+        size_t segmentCount() const { return mSegments.size(); }
+
+        /**
+         * A function that returns a segment.
+         * @param index - size_t - The index of the segment.
+         * @return std::string_view - The segment.
+         */
+        std::string_view segment(size_t index) const { return mSegments[index]; }
+
+        /**
+         * A function that returns the position of a segment in the whole text.
+         * @param index - size_t - The index of the segment.
+         * @return size_t - The offset of the first character of the segment.
+         */
+        size_t segmentOffset(size_t index) const { return mOffsets[index]; }
+
+        /**
+         * A function that finds the segment containing a position.
+         * @param offset - size_t - The position in the whole text.
+         * @return size_t - The index of the segment.
+         */
+        size_t findSegment(size_t offset) const;
+
+        /**
+         * A function that returns the character at a position.
+         * @param offset - size_t - The position in the whole text.
+         * @return char - The character.
+         */
+        char at(size_t offset) const;
+
+        /**
+         * A function that copies a part of the text, assembling it from the segments.
+         * @param offset - size_t - The position of the first character.
+         * @param length - size_t - The number of characters (clamped to the end of the text).
+         * @return std::string - The copied text.
+         */
+        std::string substr(size_t offset, size_t length) const;
+
+    private:
+        std::vector<std::string_view> mSegments;    //< The segments.
+        std::vector<size_t> mOffsets;               //< The position of each segment in the whole text.
+        size_t mLength;                             //< The length of the whole text.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef __SHUFFLE_SCANNER_HPP__
+#define __SHUFFLE_SCANNER_HPP__
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "DFATable.hpp"
+
+/**
+ * The ShuffleScanner class. Runs a DFA of at most 16 states with SIMD shuffles.
+ * The current state lives in a SSE register and each character selects a 16 bytes mask mapping every
+ * state to its successor, so a transition is a single PSHUFB instead of a dependent table load.
+ * Where SSSE3 is not available, the table is used.
+ */
+class ShuffleScanner {
+    public:
+        static constexpr size_t MaxStates = 16;     //< The maximum number of states fitting in a register.
+
+        /**
+         * A constructor.
+         * Builds the shuffle masks of the given table. The table must outlive the scanner.
+         * @param table - DFATable - The DFA to run, with at most MaxStates states.
+         */
+        ShuffleScanner(const DFATable& table);
+
+        /**
+         * A function that indicates if a table can be run by this scanner on this CPU.
+         * @param table - DFATable - The DFA to run.
+         * @return bool - True if the table is small enough and the CPU supports SSSE3.
+         */
+        static bool isApplicable(const DFATable& table);
+
+        /**
+         * A function that runs the DFA from 'begin' and returns the longest accepted prefix.
+         * @param begin - const char* - The start of the token.
+         * @param end - const char* - The end of the input.
+         * @return Match - The longest match.
+         */
+        Match match(const char* begin, const char* end) const;
+
+    private:
+        static constexpr uint8_t AcceptingFlag = 0x10;  //< Set on accepting states (ignored by PSHUFB).
+        static constexpr uint8_t DeadFlag = 0x80;       //< Used for missing transitions.
+
+        DFATable mTable;                                    //< A copy of the table, used as a fallback.
+        alignas(16) std::array<std::array<uint8_t, 16>, 256> mMasks;    //< The successors of each state, per character.
+        std::array<int, MaxStates> mTokens;                 //< The token accepted by each state.
+        uint8_t mStartState;                                //< The starting state.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,573 @@
+#ifndef __STATIC_LEXIC_HPP__
+#define __STATIC_LEXIC_HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include "LexicalErrorException.hpp"
+
+/**
+ * StaticTokenRule structure.
+ * Describes a token of a lexic known at compile time using a regex-like pattern.
+ * The supported syntax is: literals, '.', escapes (\n, \t, \r, \d, \w, \s), character classes ([a-z], [^0-9]),
+ * groups, alternations and the '*', '+' and '?' quantifiers.
+ */
+struct StaticTokenRule {
+    const char* pattern;    //< The pattern describing the token.
+    const char* type;       //< The token type.
+    int priority;           //< The token priority.
+};
+
+/**
+ * StaticDFA structure.
+ * Represents a dense DFA computed at compile time. Each state owns a row of 256 transitions.
+ */
+template <std::size_t MaxStates, std::size_t TokenCount>
+struct StaticDFA {
+    static_assert(MaxStates < 0xFFFF, "The state indices must fit in 16 bits");
+
+    static constexpr std::uint16_t DeadState = 0xFFFF;     //< The index used for missing transitions.
+
+    std::array<std::array<std::uint16_t, 256>, MaxStates> transitions{};   //< The dense transition table.
+    std::array<int, MaxStates> tokens{};                                    //< The token accepted by each state (or -1).
+    std::array<const char*, TokenCount> types{};                            //< The token types.
+    std::size_t stateCount{0};                                              //< The number of used states.
+    std::uint16_t startState{0};                                            //< The starting state.
+};
+
+/**
+ * A helper class. Compiles a list of StaticTokenRule into a StaticDFA during constant evaluation.
+ * The patterns are turned into a position automaton (Glushkov construction) that is then determinized
+ * over the byte equivalence classes of the lexic.
+ */
+template <std::size_t MaxStates, std::size_t MaxPositions>
+class StaticLexicCompiler {
+    public:
+        /**
+         * A function that compiles a list of token rules.
+         * When several rules accept the same lexeme, the one with the highest priority wins
+         * (the first declared one on equality).
+         * @param rules - StaticTokenRule[N] - The token rules.
+         * @return StaticDFA<MaxStates, N> - The dense DFA recognizing the lexic.
+         */
+        template <std::size_t N>
+        static constexpr StaticDFA<MaxStates, N> compile(const StaticTokenRule (&rules)[N]);
+
+    private:
+        static constexpr std::size_t Words = (MaxPositions + 63) / 64;
+        static constexpr std::size_t MaxNodes = 3 * MaxPositions;
+
+        struct PositionSet {
+            std::array<std::uint64_t, Words> words{};
+
+            constexpr void insert(std::size_t position) {
+                words[position / 64] |= std::uint64_t(1) << (position % 64);
+            }
+
+            constexpr bool contains(std::size_t position) const {
+                return (words[position / 64] >> (position % 64)) & 1;
+            }
+
+            constexpr void merge(const PositionSet& other) {
+                for (std::size_t i{0};i < Words;++i) {
+                    words[i] |= other.words[i];
+                }
+            }
+
+            constexpr bool empty() const {
+                for (std::size_t i{0};i < Words;++i) {
+                    if (words[i] != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            constexpr bool equals(const PositionSet& other) const {
+                for (std::size_t i{0};i < Words;++i) {
+                    if (words[i] != other.words[i]) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
+        struct ByteSet {
+            std::array<std::uint64_t, 4> words{};
+
+            constexpr void insert(unsigned char c) {
+                words[c / 64] |= std::uint64_t(1) << (c % 64);
+            }
+
+            constexpr void insertRange(unsigned char from, unsigned char to) {
+                for (unsigned int c = from;c <= to;++c) {
+                    insert(static_cast<unsigned char>(c));
+                }
+            }
+
+            constexpr void merge(const ByteSet& other) {
+                for (std::size_t i{0};i < 4;++i) {
+                    words[i] |= other.words[i];
+                }
+            }
+
+            constexpr void invert() {
+                for (std::size_t i{0};i < 4;++i) {
+                    words[i] = ~words[i];
+                }
+            }
+
+            constexpr bool contains(unsigned char c) const {
+                return (words[c / 64] >> (c % 64)) & 1;
+            }
+        };
+
+        enum class NodeKind { Empty, Leaf, Concatenation, Alternation, Star, Plus, Optional };
+
+        struct Node {
+            bool nullable{false};
+            PositionSet first{};
+            PositionSet last{};
+        };
+
+        struct Context {
+            std::array<Node, MaxNodes> nodes{};
+            std::size_t nodeCount{0};
+            std::array<ByteSet, MaxPositions> bytes{};
+            std::array<int, MaxPositions> rules{};
+            std::array<PositionSet, MaxPositions> follow{};
+            std::size_t positionCount{0};
+        };
+
+        static constexpr std::size_t addNode(Context& context, const Node& node);
+        static constexpr std::size_t addLeaf(Context& context, const ByteSet& bytes, int rule);
+        static constexpr std::size_t addNode(Context& context, NodeKind kind, std::size_t left, std::size_t right = 0);
+
+        static constexpr std::size_t parseAlternation(Context& context, const char* pattern, std::size_t& index);
+        static constexpr std::size_t parseConcatenation(Context& context, const char* pattern, std::size_t& index);
+        static constexpr std::size_t parseRepetition(Context& context, const char* pattern, std::size_t& index);
+        static constexpr std::size_t parseAtom(Context& context, const char* pattern, std::size_t& index);
+        static constexpr ByteSet parseEscape(const char* pattern, std::size_t& index);
+        static constexpr ByteSet parseClass(const char* pattern, std::size_t& index);
+};
+
+/**
+ * A function that compiles token rules into a dense DFA during constant evaluation.
+ * Usage: static constexpr auto dfa = compileLexic<64>(rules);
+ * @param rules - StaticTokenRule[N] - The token rules.
+ * @return StaticDFA<MaxStates, N> - The dense DFA recognizing the lexic.
+ */
+template <std::size_t MaxStates, std::size_t MaxPositions = 128, std::size_t N>
+constexpr StaticDFA<MaxStates, N> compileLexic(const StaticTokenRule (&rules)[N]) {
+    return StaticLexicCompiler<MaxStates, MaxPositions>::compile(rules);
+}
+
+/**
+ * A lexer class. Represents a lexer whose lexic is a StaticDFA known at compile time.
+ * It follows the same rules as Lexer: longest match, ' ' and '\n' separating tokens.
+ */
+template <const auto& Lexic>
+class StaticLexer {
+    public:
+        /**
+         * A function that extracts token from the given input and returns a list of tokens.
+         * @param input a std::string representing the input text.
+         * @return std::vector<std::pair<std::string, std::string>> - The list of pair of tokens and their types.
+         */
+        std::vector<std::pair<std::string, std::string>> extractTokens(const std::string& input) const;
+};
+
+// StaticLexicCompiler implementation
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+template <std::size_t N>
+constexpr StaticDFA<MaxStates, N> StaticLexicCompiler<MaxStates, MaxPositions>::compile(const StaticTokenRule (&rules)[N]) {
+    Context context{};
+
+    // Build the alternation of all the rules, each one followed by an end marker
+    // identifying it
+    std::size_t root = 0;
+    for (std::size_t i{0};i < N;++i) {
+        std::size_t index = 0;
+        std::size_t rule = parseAlternation(context, rules[i].pattern, index);
+        if (rules[i].pattern[index] != '\0') {
+            throw std::runtime_error("Unexpected character in a token pattern");
+        }
+
+        std::size_t marker = addLeaf(context, ByteSet{}, static_cast<int>(i));
+        rule = addNode(context, NodeKind::Concatenation, rule, marker);
+        root = (i == 0) ? rule : addNode(context, NodeKind::Alternation, root, rule);
+    }
+
+    // Compute the byte equivalence classes: two bytes are equivalent if they label
+    // exactly the same positions
+    std::array<std::size_t, 256> classOf{};
+    std::array<unsigned char, 256> representatives{};
+    std::array<PositionSet, 256> signatures{};
+    std::size_t classCount = 0;
+    for (unsigned int c = 0;c < 256;++c) {
+        PositionSet signature{};
+        for (std::size_t p{0};p < context.positionCount;++p) {
+            if (context.bytes[p].contains(static_cast<unsigned char>(c))) {
+                signature.insert(p);
+            }
+        }
+
+        std::size_t k = 0;
+        while (k < classCount && !signatures[k].equals(signature)) {
+            k++;
+        }
+        if (k == classCount) {
+            signatures[k] = signature;
+            representatives[k] = static_cast<unsigned char>(c);
+            classCount++;
+        }
+        classOf[c] = k;
+    }
+
+    // Subset construction on the position sets
+    StaticDFA<MaxStates, N> dfa{};
+    std::array<PositionSet, MaxStates> states{};
+    std::array<std::array<std::uint16_t, 256>, MaxStates> classTransitions{};
+    states[0] = context.nodes[root].first;
+    std::size_t stateCount = 1;
+
+    for (std::size_t s{0};s < stateCount;++s) {
+        for (std::size_t k{0};k < classCount;++k) {
+            PositionSet next{};
+            for (std::size_t p{0};p < context.positionCount;++p) {
+                if (states[s].contains(p) && context.bytes[p].contains(representatives[k])) {
+                    next.merge(context.follow[p]);
+                }
+            }
+
+            if (next.empty()) {
+                classTransitions[s][k] = dfa.DeadState;
+                continue;
+            }
+
+            std::size_t target = 0;
+            while (target < stateCount && !states[target].equals(next)) {
+                target++;
+            }
+            if (target == stateCount) {
+                if (stateCount == MaxStates) {
+                    throw std::runtime_error("The lexic needs more states than MaxStates");
+                }
+                states[stateCount++] = next;
+            }
+            classTransitions[s][k] = static_cast<std::uint16_t>(target);
+        }
+
+        // The state accepts the end marker with the highest priority
+        int token = -1;
+        for (std::size_t p{0};p < context.positionCount;++p) {
+            int rule = context.rules[p];
+            if (rule >= 0 && states[s].contains(p) &&
+                (token < 0 || rules[rule].priority > rules[token].priority)) {
+                token = rule;
+            }
+        }
+        dfa.tokens[s] = token;
+    }
+
+    // Expand the class transitions to the dense table
+    for (std::size_t s{0};s < stateCount;++s) {
+        for (unsigned int c = 0;c < 256;++c) {
+            dfa.transitions[s][c] = classTransitions[s][classOf[c]];
+        }
+    }
+    for (std::size_t s{stateCount};s < MaxStates;++s) {
+        dfa.tokens[s] = -1;
+        for (unsigned int c = 0;c < 256;++c) {
+            dfa.transitions[s][c] = dfa.DeadState;
+        }
+    }
+    for (std::size_t i{0};i < N;++i) {
+        dfa.types[i] = rules[i].type;
+    }
+    dfa.stateCount = stateCount;
+    dfa.startState = 0;
+
+    return dfa;
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::addNode(Context& context, const Node& node) {
+    if (context.nodeCount == MaxNodes) {
+        throw std::runtime_error("The lexic patterns are too large, increase MaxPositions");
+    }
+    context.nodes[context.nodeCount] = node;
+    return context.nodeCount++;
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::addLeaf(Context& context, const ByteSet& bytes, int rule) {
+    if (context.positionCount == MaxPositions) {
+        throw std::runtime_error("The lexic patterns are too large, increase MaxPositions");
+    }
+    std::size_t position = context.positionCount++;
+    context.bytes[position] = bytes;
+    context.rules[position] = rule;
+
+    Node node{};
+    node.first.insert(position);
+    node.last.insert(position);
+    return addNode(context, node);
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::addNode(Context& context, NodeKind kind,
+                                                                            std::size_t left, std::size_t right) {
+    Node node{};
+    const Node a = context.nodes[left];
+    const Node b = context.nodes[right];
+
+    switch (kind) {
+        case NodeKind::Concatenation:
+            node.nullable = a.nullable && b.nullable;
+            node.first = a.first;
+            if (a.nullable) {
+                node.first.merge(b.first);
+            }
+            node.last = b.last;
+            if (b.nullable) {
+                node.last.merge(a.last);
+            }
+            for (std::size_t p{0};p < context.positionCount;++p) {
+                if (a.last.contains(p)) {
+                    context.follow[p].merge(b.first);
+                }
+            }
+            break;
+        case NodeKind::Alternation:
+            node.nullable = a.nullable || b.nullable;
+            node.first = a.first;
+            node.first.merge(b.first);
+            node.last = a.last;
+            node.last.merge(b.last);
+            break;
+        case NodeKind::Star:
+        case NodeKind::Plus:
+            node.nullable = (kind == NodeKind::Star) || a.nullable;
+            node.first = a.first;
+            node.last = a.last;
+            for (std::size_t p{0};p < context.positionCount;++p) {
+                if (a.last.contains(p)) {
+                    context.follow[p].merge(a.first);
+                }
+            }
+            break;
+        case NodeKind::Optional:
+            node.nullable = true;
+            node.first = a.first;
+            node.last = a.last;
+            break;
+        default:
+            node.nullable = true;
+            break;
+    }
+
+    return addNode(context, node);
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::parseAlternation(Context& context, const char* pattern,
+                                                                                     std::size_t& index) {
+    std::size_t node = parseConcatenation(context, pattern, index);
+    while (pattern[index] == '|') {
+        index++;
+        std::size_t right = parseConcatenation(context, pattern, index);
+        node = addNode(context, NodeKind::Alternation, node, right);
+    }
+    return node;
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::parseConcatenation(Context& context, const char* pattern,
+                                                                                       std::size_t& index) {
+    bool hasNode = false;
+    std::size_t node = 0;
+    while (pattern[index] != '\0' && pattern[index] != '|' && pattern[index] != ')') {
+        std::size_t atom = parseRepetition(context, pattern, index);
+        node = hasNode ? addNode(context, NodeKind::Concatenation, node, atom) : atom;
+        hasNode = true;
+    }
+    return hasNode ? node : addNode(context, Node{true});
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::parseRepetition(Context& context, const char* pattern,
+                                                                                    std::size_t& index) {
+    std::size_t node = parseAtom(context, pattern, index);
+    while (pattern[index] == '*' || pattern[index] == '+' || pattern[index] == '?') {
+        NodeKind kind = (pattern[index] == '*') ? NodeKind::Star :
+                        (pattern[index] == '+') ? NodeKind::Plus : NodeKind::Optional;
+        node = addNode(context, kind, node);
+        index++;
+    }
+    return node;
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr std::size_t StaticLexicCompiler<MaxStates, MaxPositions>::parseAtom(Context& context, const char* pattern,
+                                                                              std::size_t& index) {
+    ByteSet bytes{};
+    switch (pattern[index]) {
+        case '(': {
+            index++;
+            std::size_t node = parseAlternation(context, pattern, index);
+            if (pattern[index] != ')') {
+                throw std::runtime_error("Missing ')' in a token pattern");
+            }
+            index++;
+            return node;
+        }
+        case '[':
+            index++;
+            bytes = parseClass(pattern, index);
+            break;
+        case '.':
+            index++;
+            bytes.invert();
+            bytes.words['\n' / 64] &= ~(std::uint64_t(1) << ('\n' % 64));
+            break;
+        case '\\':
+            index++;
+            bytes = parseEscape(pattern, index);
+            break;
+        case '*':
+        case '+':
+        case '?':
+            throw std::runtime_error("A quantifier must follow an expression in a token pattern");
+        default:
+            bytes.insert(static_cast<unsigned char>(pattern[index++]));
+            break;
+    }
+    return addLeaf(context, bytes, -1);
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr typename StaticLexicCompiler<MaxStates, MaxPositions>::ByteSet
+StaticLexicCompiler<MaxStates, MaxPositions>::parseEscape(const char* pattern, std::size_t& index) {
+    ByteSet bytes{};
+    char c = pattern[index];
+    if (c == '\0') {
+        throw std::runtime_error("Unterminated escape sequence in a token pattern");
+    }
+    index++;
+
+    switch (c) {
+        case 'n': bytes.insert('\n'); break;
+        case 't': bytes.insert('\t'); break;
+        case 'r': bytes.insert('\r'); break;
+        case 'd': bytes.insertRange('0', '9'); break;
+        case 's':
+            bytes.insert(' ');
+            bytes.insertRange('\t', '\r');
+            break;
+        case 'w':
+            bytes.insertRange('a', 'z');
+            bytes.insertRange('A', 'Z');
+            bytes.insertRange('0', '9');
+            bytes.insert('_');
+            break;
+        default: bytes.insert(static_cast<unsigned char>(c)); break;
+    }
+    return bytes;
+}
+
+template <std::size_t MaxStates, std::size_t MaxPositions>
+constexpr typename StaticLexicCompiler<MaxStates, MaxPositions>::ByteSet
+StaticLexicCompiler<MaxStates, MaxPositions>::parseClass(const char* pattern, std::size_t& index) {
+    ByteSet bytes{};
+    bool negated = false;
+    if (pattern[index] == '^') {
+        negated = true;
+        index++;
+    }
+
+    bool first = true;
+    while (pattern[index] != ']' || first) {
+        first = false;
+        if (pattern[index] == '\0') {
+            throw std::runtime_error("Missing ']' in a token pattern");
+        }
+
+        if (pattern[index] == '\\') {
+            index++;
+            bytes.merge(parseEscape(pattern, index));
+            continue;
+        }
+
+        unsigned char from = static_cast<unsigned char>(pattern[index++]);
+        if (pattern[index] == '-' && pattern[index + 1] != ']' && pattern[index + 1] != '\0') {
+            unsigned char to = static_cast<unsigned char>(pattern[index + 1]);
+            if (to < from) {
+                throw std::runtime_error("Invalid range in a token pattern");
+            }
+            bytes.insertRange(from, to);
+            index += 2;
+        } else {
+            bytes.insert(from);
+        }
+    }
+    index++;
+
+    if (negated) {
+        bytes.invert();
+    }
+    return bytes;
+}
+
+// StaticLexer implementation
+
+template <const auto& Lexic>
+std::vector<std::pair<std::string, std::string>> StaticLexer<Lexic>::extractTokens(const std::string& input) const {
+    using DFA = std::decay_t<decltype(Lexic)>;
+
+    std::vector<std::pair<std::string, std::string>> tokens;
+    size_t startPosition = 0;
+
+    while (startPosition < input.length()) {
+        std::uint16_t state = Lexic.startState;
+        size_t position = startPosition;
+        size_t lastAcceptPosition = startPosition;
+        int lastToken = -1;
+
+        // Follow the transitions as long as possible, remembering the last accepting state
+        while (position < input.length()) {
+            state = Lexic.transitions[state][static_cast<unsigned char>(input[position])];
+            if (state == DFA::DeadState) {
+                break;
+            }
+            position++;
+
+            if (Lexic.tokens[state] >= 0) {
+                lastAcceptPosition = position;
+                lastToken = Lexic.tokens[state];
+            }
+        }
+
+        if (lastToken >= 0) {
+            tokens.emplace_back(std::string(input, startPosition, lastAcceptPosition - startPosition),
+                                Lexic.types[lastToken]);
+            startPosition = lastAcceptPosition;
+        } else if (position == startPosition && (input[position] == ' ' || input[position] == '\n')) {
+            startPosition++;
+        } else {
+            std::string unknownToken(input, startPosition, position + 1 - startPosition);
+            throw LexicalErrorException::unknownToken(unknownToken, startPosition);
+        }
+    }
+
+    return tokens;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef __SYMBOL_TABLE_HPP__
+#define __SYMBOL_TABLE_HPP__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * The SymbolTable class. Interns strings (the identifiers of an input) into dense symbol ids.
+ * Each string is stored once. The table is split in shards, each an open-addressing hash table with its own
+ * lock and its own strings, so that several lexing threads can intern into the same table. The ids come from
+ * an atomic counter and the strings are published in a lock-free directory, so no lock is shared by the shards.
+ */
+class SymbolTable {
+    public:
+        static constexpr size_t ShardCount = 16;            //< The number of independently locked shards.
+        static constexpr uint32_t NoSymbol = UINT32_MAX;    //< The symbol id of the tokens that aren't interned.
+
+        /**
+         * A constructor.
+         * Constructs an empty table.
+         */
+        SymbolTable();
+
+        SymbolTable(const SymbolTable&) = delete;
+        SymbolTable& operator=(const SymbolTable&) = delete;
+
+        /**
+         * A destructor.
+         * Frees the directory of the strings.
+         */
+        ~SymbolTable();
+
+        /**
+         * A function that returns the symbol id of a string, adding it to the table if needed.
+         * @param name - std::string_view - The string.
+         * @return uint32_t - The symbol id. The ids are dense (from 0 to size() - 1), and given in the order in
+         *         which the strings are added, whatever the thread adding them.
+         */
+        uint32_t intern(std::string_view name) { return intern(name, hash(name)); }
+
+        /**
+         * A function that returns the symbol id of a string whose hash is already known.
+         * @param name - std::string_view - The string.
+         * @param hash - uint64_t - The hash of the string (see hash).
+         * @return uint32_t - The symbol id.
+         */
+        uint32_t intern(std::string_view name, uint64_t hash);
+
+        /**
+         * A function that returns the string of a symbol.
+         * It doesn't lock, the symbol being one returned by intern (on any thread, before this call).
+         * @param symbol - uint32_t - The symbol id.
+         * @return std::string_view - The string, valid as long as the table.
+         */
+        std::string_view name(uint32_t symbol) const;
+
+        /**
+         * A function that returns the number of symbols.
+         * @return size_t - The number of interned strings.
+         */
+        size_t size() const { return mSymbolCount.load(std::memory_order_acquire); }
+
+        /**
+         * A function that hashes a string (64 bits FNV-1a).
+         * @param name - std::string_view - The string.
+         * @return uint64_t - The hash.
+         */
+        static uint64_t hash(std::string_view name);
+
+    private:
+        /**
+         * An entry of a shard.
+         */
+        struct Slot {
+            uint64_t hash;          //< The hash of the string.
+            uint32_t symbol;        //< The symbol id, NoSymbol if the slot is empty.
+            std::string_view name;  //< The string.
+        };
+
+        /**
+         * An open-addressing hash table with linear probing.
+         */
+        struct Shard {
+            std::mutex mutex;               //< The lock of the shard.
+            std::vector<Slot> slots;        //< The slots (a power of two).
+            size_t count;                   //< The number of used slots.
+            std::deque<std::string> names;  //< The strings of the shard (a deque doesn't move them).
+        };
+
+        using Entry = std::atomic<const std::string*>;
+
+        static constexpr size_t FirstChunkSize = 1024;  //< The number of entries of the first chunk of the directory.
+        static constexpr size_t ChunkCount = 23;        //< The number of chunks needed for all the 32 bits ids.
+
+        std::array<Shard, ShardCount> mShards;                  //< The shards, chosen by the high bits of the hash.
+        std::atomic<uint32_t> mSymbolCount;                     //< The number of symbols, giving the next id.
+        std::array<std::atomic<Entry*>, ChunkCount> mDirectory; //< The strings by symbol id, in chunks doubling in size.
+
+        /**
+         * A function that finds the place of a symbol in the directory.
+         * @param symbol - uint32_t - The symbol id.
+         * @return std::pair<size_t, size_t> - The index of the chunk and the index of the entry in the chunk.
+         */
+        static std::pair<size_t, size_t> locate(uint32_t symbol);
+
+        /**
+         * A function that doubles the number of slots of a shard.
+         * @param shard - Shard& - The shard (locked).
+         */
+        static void grow(Shard& shard);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef __SYMBOL_TOKEN_HPP__
+#define __SYMBOL_TOKEN_HPP__
+
+#include <cstdint>
+
+#include "Token.hpp"
+
+/**
+ * SymbolToken structure.
+ * Represents a token with the symbol id of its lexeme when it is an identifier (see Lexer::tokenizeSymbols).
+ */
+struct SymbolToken {
+    Token token;        //< The token.
+    uint32_t symbol;    //< The symbol id in the SymbolTable, or SymbolTable::NoSymbol.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef __SYNC_ANALYSIS_HPP__
+#define __SYNC_ANALYSIS_HPP__
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "DFATable.hpp"
+
+/**
+ * The SyncAnalysis class. Finds where the lexer is guaranteed to restart from the starting state.
+ * A boundary character can't be consumed by any state, so no token contains it and every run of the
+ * DFA stops before it. If it is also a separator (' ' or '\n') that can't start a token, the lexer
+ * looks for a token exactly at its position whatever happened before: it is a sync character, and
+ * an input can be cut or re-lexed from there without knowing its beginning.
+ * Sync characters are found per byte: a character that some state consumes is never a sync character,
+ * even if it only is in some contexts (like a newline that only a string literal can contain).
+ * The analysis also bounds the number of characters after which two runs of the lexer started at
+ * different positions look for tokens at the same positions (see convergenceLength).
+ */
+class SyncAnalysis {
+    public:
+        static constexpr size_t Unbounded = SIZE_MAX;   //< The length returned when the DFA has cycles.
+
+        /**
+         * A constructor.
+         * Analyzes the given table.
+         * @param table - DFATable - The DFA of the lexic.
+         */
+        SyncAnalysis(const DFATable& table);
+
+        /**
+         * A function that indicates if no token can contain a character.
+         * @param character - unsigned char - The character.
+         * @return bool - True if no state has a transition labelled by the character.
+         */
+        bool isBoundaryCharacter(unsigned char character) const { return mBoundaries[character]; }
+
+        /**
+         * A function that indicates if the lexer always restarts at a character.
+         * @param character - unsigned char - The character.
+         * @return bool - True if the character is a boundary character that is skipped as a separator.
+         */
+        bool isSyncCharacter(unsigned char character) const { return mSyncs[character]; }
+
+        /**
+         * A function that indicates if a token can start with a character.
+         * @param character - unsigned char - The character.
+         * @return bool - True if a token starts with the character.
+         */
+        bool canStartToken(unsigned char character) const { return mStarts[character]; }
+
+        /**
+         * A function that indicates if the lexic has sync characters.
+         * @return bool - True if at least one character is a sync character.
+         */
+        bool hasSyncCharacters() const { return mHasSyncCharacters; }
+
+        /**
+         * A function that returns the maximum number of characters read by the DFA from a token start.
+         * A token only depends on the characters in this range, whatever is after.
+         * @return size_t - The maximum number of characters or Unbounded.
+         */
+        size_t maxScanLength() const { return mMaxScanLength; }
+
+        /**
+         * A function that returns the length of the longest token.
+         * @return size_t - The maximum length or Unbounded.
+         */
+        size_t maxTokenLength() const { return mMaxTokenLength; }
+
+        /**
+         * A function that returns the number of characters after which the runs of the lexer converge.
+         * A run started from the starting state at any position of an input looks for tokens at the same
+         * positions as the lexing of the whole input after at most this many characters, unless one of
+         * them finds an invalid token. The lexing is modelled without backtracking, so the length is
+         * Unbounded when a token can end before the last character read (as well as when runs can stay
+         * apart forever, or when there are too many pairs of runs to analyze).
+         * @return size_t - The maximum number of characters or Unbounded.
+         */
+        size_t convergenceLength() const { return mConvergenceLength; }
+
+        /**
+         * A function that finds the first position in [from, to) where the lexer is guaranteed to look for a token.
+         * @param input - std::string - The input text.
+         * @param from - size_t - The first position to consider.
+         * @param to - size_t - The end of the search.
+         * @return size_t - The position of the first sync character or std::string::npos.
+         */
+        size_t nextSyncPoint(const std::string& input, size_t from, size_t to) const;
+
+        /**
+         * A function that finds the last position before 'position' where the lexer is guaranteed to look for a token.
+         * @param input - std::string - The input text.
+         * @param position - size_t - The position to start from (excluded).
+         * @return size_t - The position of the last sync character, or 0 (the start of the input).
+         */
+        size_t previousSyncPoint(const std::string& input, size_t position) const;
+
+        /**
+         * A function that finds the nearest position, at or before 'offset', where the lexing of the whole input
+         * looks for a token (a token start or a skipped separator), so that lexing from it gives the same tokens.
+         * When the runs converge (see convergenceLength), a run started a few characters before 'offset' is
+         * enough to confirm the position, the window being widened until it contains one. Otherwise, the input
+         * is lexed from the previous sync point (or from its beginning).
+         * If the lexing finds an invalid token before 'offset', its position is returned.
+         * @param table - DFATable - The DFA of the lexic (the one that was analyzed).
+         * @param input - std::string - The input text.
+         * @param offset - size_t - The position to start from.
+         * @return size_t - The position where the lexing looks for a token.
+         */
+        size_t findTokenStart(const DFATable& table, const std::string& input, size_t offset) const;
+
+    private:
+        std::array<bool, 256> mBoundaries;  //< The boundary characters.
+        std::array<bool, 256> mSyncs;       //< The sync characters.
+        std::array<bool, 256> mStarts;      //< The first characters of the tokens.
+        bool mHasSyncCharacters;            //< A boolean indicating if there is a sync character.
+        size_t mMaxScanLength;              //< The maximum number of characters read from a token start.
+        size_t mMaxTokenLength;             //< The length of the longest token.
+        size_t mConvergenceLength;          //< The number of characters after which the runs converge.
+
+        static constexpr size_t MaxAnalyzedPairs = 1 << 16;    //< The maximum number of pairs of runs analyzed.
+
+        /**
+         * A function that computes the longest path from the starting state through the allowed states.
+         * @param table - DFATable - The DFA.
+         * @param allowed - std::vector<bool> - The states the path can go through.
+         * @return size_t - The length of the longest path or Unbounded if there is a cycle.
+         */
+        static size_t longestPath(const DFATable& table, const std::vector<bool>& allowed);
+
+        /**
+         * A function that computes the number of characters after which the runs of the lexer converge.
+         * @param table - DFATable - The DFA.
+         * @return size_t - The maximum number of characters or Unbounded (see convergenceLength).
+         */
+        static size_t runConvergence(const DFATable& table);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef __TEXT_EDIT_HPP__
+#define __TEXT_EDIT_HPP__
+
+#include <cstddef>
+
+/**
+ * TextEdit structure.
+ * Represents the replacement of a part of a text by another text.
+ */
+struct TextEdit {
+    size_t offset;          //< The position of the edit.
+    size_t removedLength;   //< The number of characters removed at the position.
+    size_t insertedLength;  //< The number of characters inserted at the position.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef __THREADED_SCANNER_HPP__
+#define __THREADED_SCANNER_HPP__
+
+#include <cstdint>
+#include <vector>
+
+#include "DFATable.hpp"
+
+/**
+ * The ThreadedScanner class. Runs a DFATable with a threaded interpreter.
+ * Each state is classified (dense row, accepting, accelerable, chain) and the interpreter jumps
+ * directly from the handler of a state to the handler of the next one using computed gotos, so each
+ * kind of state has its own dispatch site. Without GCC/Clang labels-as-values, the table is used.
+ */
+class ThreadedScanner {
+    public:
+        /**
+         * The kinds of state, each one having its own handler.
+         */
+        enum class Kind : uint8_t {
+            Dense,          //< A state reading its transition in its row.
+            Accepting,      //< An accepting state reading its transition in its row.
+            Accelerable,    //< A state looping on itself, consuming the loop characters in a tight loop.
+            Chain           //< A state with a single outgoing transition.
+        };
+
+        /**
+         * A constructor.
+         * Classifies the states of the given table. The table must outlive the scanner.
+         * @param table - DFATable - The DFA to run.
+         */
+        ThreadedScanner(const DFATable& table);
+
+        /**
+         * A function that returns the kind of a state.
+         * @param state - uint32_t - The state.
+         * @return Kind - The kind of the state.
+         */
+        Kind kind(uint32_t state) const { return static_cast<Kind>(mKinds[state]); }
+
+        /**
+         * A function that runs the DFA from 'begin' and returns the longest accepted prefix.
+         * @param begin - const char* - The start of the token.
+         * @param end - const char* - The end of the input.
+         * @return Match - The longest match.
+         */
+        Match match(const char* begin, const char* end) const;
+
+    private:
+        DFATable mTable;                        //< A copy of the table containing the transitions.
+        std::vector<uint8_t> mKinds;            //< The kind of each state.
+        std::vector<unsigned char> mChainCharacters;    //< The character of the transition of chain states.
+        std::vector<uint32_t> mChainTargets;    //< The target of the transition of chain states.
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef __TOKEN_HPP__
+#define __TOKEN_HPP__
+
+#include <cstddef>
+
+/**
+ * Token structure.
+ * Represents a token found in an input, as a span of the input and a token id.
+ */
+struct Token {
+    size_t offset;      //< The position of the first character of the token in the input.
+    size_t length;      //< The number of characters of the token.
+    int type;           //< The token id (see Lexer::tokenType).
+};
+
+#endif
\ No newline at end of file
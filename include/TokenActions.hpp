@@ -0,0 +1,61 @@
+#ifndef __TOKEN_ACTIONS_HPP__
+#define __TOKEN_ACTIONS_HPP__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+class Lexer;
+
+/**
+ * The TokenActions class. A dense table of the actions run for each token type.
+ * The token types are resolved to token ids when the actions are registered, so dispatching a token is
+ * one indexed load and one indirect call. It is a sink for Lexer::lex:
+ *     TokenActions actions(lexer);
+ *     actions.on("NUM", [](const char* begin, const char* end) { ... });
+ *     lexer.lex(input, actions);
+ */
+class TokenActions {
+    public:
+        using Action = std::function<void(const char*, const char*)>;  //< An action, receiving the characters of a token.
+
+        /**
+         * A constructor.
+         * Constructs a table without actions for the token types of a lexer.
+         * @param lexer - const Lexer& - The lexer.
+         */
+        TokenActions(const Lexer& lexer);
+
+        /**
+         * Registers the action of a token type, replacing the previous one.
+         * @param type - std::string - The token type.
+         * @param action - Action - The action.
+         */
+        void on(const std::string& type, Action action);
+
+        /**
+         * Registers the action of the token types without action.
+         * @param action - Action - The action.
+         */
+        void otherwise(Action action) { mDefaultAction = std::move(action); }
+
+        /**
+         * Runs the action of a token (called by Lexer::lex).
+         * @param type - int - The token id.
+         * @param begin - const char* - The first character of the token.
+         * @param end - const char* - The character following the token.
+         */
+        void onToken(int type, const char* begin, const char* end) const {
+            const Action& action = mActions[type] ? mActions[type] : mDefaultAction;
+            if (action) {
+                action(begin, end);
+            }
+        }
+
+    private:
+        const Lexer& mLexer;            //< The lexer resolving the token types.
+        std::vector<Action> mActions;   //< The actions, indexed by token id.
+        Action mDefaultAction;          //< The action of the token types without action.
+};
+
+#endif
\ No newline at end of file
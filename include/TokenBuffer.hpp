@@ -0,0 +1,95 @@
+#ifndef __TOKEN_BUFFER_HPP__
+#define __TOKEN_BUFFER_HPP__
+
+#include <cstddef>
+#include <vector>
+
+#include "Token.hpp"
+
+/**
+ * The TokenBuffer class. Stores tokens as separate arrays of offsets, lengths and token ids.
+ * Clearing the buffer keeps its capacity, so that it can be reused across inputs without allocation.
+ */
+class TokenBuffer {
+    public:
+        /**
+         * Adds a token at the end of the buffer.
+         * @param offset - size_t - The position of the first character of the token.
+         * @param length - size_t - The number of characters of the token.
+         * @param type - int - The token id.
+         */
+        void append(size_t offset, size_t length, int type) {
+            mOffsets.push_back(offset);
+            mLengths.push_back(length);
+            mTypes.push_back(type);
+        }
+
+        /**
+         * Removes all the tokens, keeping the allocated memory.
+         */
+        void clear() {
+            mOffsets.clear();
+            mLengths.clear();
+            mTypes.clear();
+        }
+
+        /**
+         * Allocates the memory for a number of tokens.
+         * @param capacity - size_t - The number of tokens.
+         */
+        void reserve(size_t capacity) {
+            mOffsets.reserve(capacity);
+            mLengths.reserve(capacity);
+            mTypes.reserve(capacity);
+        }
+
+        /**
+         * A function that returns the number of tokens of the buffer.
+         * @return size_t - The number of tokens.
+         */
+        size_t size() const { return mTypes.size(); }
+
+        /**
+         * A function that indicates if the buffer has no token.
+         * @return bool - True if the buffer is empty.
+         */
+        bool empty() const { return mTypes.empty(); }
+
+        /**
+         * A function that returns the number of tokens the buffer can hold without allocation.
+         * @return size_t - The number of tokens.
+         */
+        size_t capacity() const { return mTypes.capacity(); }
+
+        /**
+         * A function that returns a token of the buffer.
+         * @param index - size_t - The index of the token.
+         * @return Token - The token.
+         */
+        Token operator[](size_t index) const { return Token{mOffsets[index], mLengths[index], mTypes[index]}; }
+
+        /**
+         * A function that returns the offsets of the tokens.
+         * @return const std::vector<size_t>& - The positions of the first characters of the tokens, in order.
+         */
+        const std::vector<size_t>& offsets() const { return mOffsets; }
+
+        /**
+         * A function that returns the lengths of the tokens.
+         * @return const std::vector<size_t>& - The numbers of characters of the tokens, in order.
+         */
+        const std::vector<size_t>& lengths() const { return mLengths; }
+
+        /**
+         * A function that returns the token ids of the tokens.
+         * @return const std::vector<int>& - The token ids (see Lexer::tokenType), in order.
+         */
+        const std::vector<int>& types() const { return mTypes; }
+
+    private:
+        std::vector<size_t> mOffsets;   //< The positions of the tokens.
+        std::vector<size_t> mLengths;   //< The lengths of the tokens.
+        std::vector<int> mTypes;        //< The token ids.
+};
+
+#endif
\ No newline at end of file
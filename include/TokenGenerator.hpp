@@ -0,0 +1,213 @@
+#ifndef __TOKEN_GENERATOR_HPP__
+#define __TOKEN_GENERATOR_HPP__
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "Token.hpp"
+
+/**
+ * The TokenGenerator class. A coroutine yielding the tokens of an input one at a time (see Lexer::generate).
+ */
+class TokenGenerator {
+    public:
+        /**
+         * The state of the coroutine.
+         */
+        struct promise_type {
+            Token token;                    //< The last yielded token.
+            std::exception_ptr exception;   //< The exception thrown by the lexing, if any.
+
+            TokenGenerator get_return_object() { return TokenGenerator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            std::suspend_always yield_value(const Token& value) noexcept {
+                token = value;
+                return {};
+            }
+            void return_void() noexcept {}
+            void unhandled_exception() { exception = std::current_exception(); }
+        };
+
+        /**
+         * The input iterator of a TokenGenerator.
+         */
+        class Iterator {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = Token;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Token*;
+                using reference = const Token&;
+
+                Iterator() : mHandle(nullptr) {}
+                Iterator(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+
+                reference operator*() const { return mHandle.promise().token; }
+                pointer operator->() const { return &mHandle.promise().token; }
+
+                /**
+                 * Resumes the coroutine until it yields the next token.
+                 * @return Iterator& - The iterator, equal to the end iterator if there are no more tokens.
+                 */
+                Iterator& operator++() {
+                    mHandle.resume();
+                    if (mHandle.done()) {
+                        std::exception_ptr exception = mHandle.promise().exception;
+                        mHandle = nullptr;
+                        if (exception) {
+                            std::rethrow_exception(exception);
+                        }
+                    }
+                    return *this;
+                }
+
+                void operator++(int) { ++*this; }
+
+                bool operator==(const Iterator& other) const { return mHandle == other.mHandle; }
+                bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+            private:
+                std::coroutine_handle<promise_type> mHandle;   //< The coroutine, or nullptr for the end iterator.
+        };
+
+        TokenGenerator(TokenGenerator&& other) noexcept : mHandle(std::exchange(other.mHandle, nullptr)) {}
+        TokenGenerator(const TokenGenerator&) = delete;
+        TokenGenerator& operator=(const TokenGenerator&) = delete;
+
+        ~TokenGenerator() {
+            if (mHandle) {
+                mHandle.destroy();
+            }
+        }
+
+        /**
+         * Starts the coroutine. A generator can only be iterated once.
+         * @return Iterator - The iterator on the first token.
+         */
+        Iterator begin() {
+            Iterator it(mHandle);
+            ++it;
+            return it;
+        }
+
+        Iterator end() { return Iterator(); }
+
+    private:
+        std::coroutine_handle<promise_type> mHandle;   //< The coroutine.
+
+        explicit TokenGenerator(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+};
+
+/**
+ * StreamedToken structure.
+ * Represents a token of a stream, with its characters (only valid until the stream is resumed).
+ */
+struct StreamedToken {
+    Token token;            //< The token, its offset is counted from the start of the stream.
+    std::string_view text;  //< The characters of the token.
+};
+
+/**
+ * The AsyncTokenGenerator class. A coroutine yielding the tokens of a stream as its input arrives (see Lexer::lexAsync).
+ * The consumer awaits next() from its own coroutine. While the lexing waits for more input, both are
+ * suspended and no thread is blocked.
+ */
+class AsyncTokenGenerator {
+    public:
+        /**
+         * The state of the coroutine.
+         */
+        struct promise_type {
+            std::optional<StreamedToken> token;     //< The last yielded token.
+            std::exception_ptr exception;           //< The exception thrown by the lexing, if any.
+            std::coroutine_handle<> consumer;       //< The coroutine waiting for the next token.
+
+            /**
+             * The awaiter resuming the consumer when a token is yielded or when the lexing ends.
+             */
+            struct Transfer {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                    return handle.promise().consumer;
+                }
+                void await_resume() const noexcept {}
+            };
+
+            AsyncTokenGenerator get_return_object() { return AsyncTokenGenerator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            Transfer final_suspend() noexcept { return {}; }
+            Transfer yield_value(const StreamedToken& value) noexcept {
+                token = value;
+                return {};
+            }
+            void return_void() noexcept { token.reset(); }
+            void unhandled_exception() {
+                token.reset();
+                exception = std::current_exception();
+            }
+        };
+
+        /**
+         * The awaiter returned by next().
+         */
+        class NextToken {
+            public:
+                NextToken(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+
+                bool await_ready() const noexcept { return !mHandle || mHandle.done(); }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept {
+                    mHandle.promise().consumer = consumer;
+                    return mHandle;
+                }
+
+                /**
+                 * Returns the yielded token.
+                 * @return std::optional<StreamedToken> - The token, or nothing at the end of the stream.
+                 */
+                std::optional<StreamedToken> await_resume() const {
+                    if (!mHandle || !mHandle.done()) {
+                        return mHandle ? mHandle.promise().token : std::nullopt;
+                    }
+                    if (std::exception_ptr exception = std::exchange(mHandle.promise().exception, nullptr)) {
+                        std::rethrow_exception(exception);
+                    }
+                    return std::nullopt;
+                }
+
+            private:
+                std::coroutine_handle<promise_type> mHandle;   //< The lexing coroutine.
+        };
+
+        AsyncTokenGenerator(AsyncTokenGenerator&& other) noexcept : mHandle(std::exchange(other.mHandle, nullptr)) {}
+        AsyncTokenGenerator(const AsyncTokenGenerator&) = delete;
+        AsyncTokenGenerator& operator=(const AsyncTokenGenerator&) = delete;
+
+        ~AsyncTokenGenerator() {
+            if (mHandle) {
+                mHandle.destroy();
+            }
+        }
+
+        /**
+         * A function that returns an awaitable on the next token.
+         * @return NextToken - The awaitable, producing the token or nothing at the end of the stream.
+         */
+        NextToken next() { return NextToken(mHandle); }
+
+    private:
+        std::coroutine_handle<promise_type> mHandle;   //< The coroutine.
+
+        explicit AsyncTokenGenerator(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+};
+
+#endif
+
+#endif
\ No newline at end of file
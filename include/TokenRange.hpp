@@ -0,0 +1,116 @@
+#ifndef __TOKEN_RANGE_HPP__
+#define __TOKEN_RANGE_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+#include "Token.hpp"
+
+class Lexer;
+
+/**
+ * The TokenRange class. A range lazily extracting the tokens of an input.
+ * Each increment of its iterator extracts a single token, so a consumer only holds the current one.
+ * The lexer and the input must outlive the range.
+ */
+class TokenRange {
+    public:
+        /**
+         * The input iterator of a TokenRange.
+         */
+        class Iterator {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = Token;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Token*;
+                using reference = const Token&;
+
+                /**
+                 * A constructor.
+                 * Constructs the end iterator.
+                 */
+                Iterator();
+
+                /**
+                 * A constructor.
+                 * Constructs an iterator on the first token of a range.
+                 * @param range - const TokenRange* - The range.
+                 */
+                Iterator(const TokenRange* range);
+
+                /**
+                 * Returns the current token.
+                 * @return const Token& - The token.
+                 */
+                reference operator*() const { return mToken; }
+
+                /**
+                 * Gives access to the members of the current token.
+                 * @return const Token* - The token.
+                 */
+                pointer operator->() const { return &mToken; }
+
+                /**
+                 * Extracts the next token.
+                 * @return Iterator& - The iterator, equal to the end iterator if there are no more tokens.
+                 */
+                Iterator& operator++();
+
+                /**
+                 * Extracts the next token.
+                 * @return Iterator - The iterator on the previous token.
+                 */
+                Iterator operator++(int) {
+                    Iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                /**
+                 * Compares two iterators.
+                 * @param other - const Iterator& - The other iterator.
+                 * @return bool - True if both are the end iterator, or are on the same token of the same range.
+                 */
+                bool operator==(const Iterator& other) const { return mRange == other.mRange && mPosition == other.mPosition; }
+
+                /**
+                 * Compares two iterators.
+                 * @param other - const Iterator& - The other iterator.
+                 * @return bool - True if the iterators are not equal.
+                 */
+                bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+            private:
+                const TokenRange* mRange;   //< The range, or nullptr for the end iterator.
+                size_t mPosition;           //< The position where the next token is looked for.
+                Token mToken;               //< The current token.
+        };
+
+        /**
+         * A constructor.
+         * Constructs the range of the tokens of an input.
+         * @param lexer - const Lexer& - The lexer.
+         * @param input - const std::string& - The input text.
+         */
+        TokenRange(const Lexer& lexer, const std::string& input) : mLexer(lexer), mInput(input) {}
+
+        /**
+         * A function that returns an iterator on the first token, extracting it.
+         * @return Iterator - The iterator, equal to end() if the input has no token.
+         */
+        Iterator begin() const { return Iterator(this); }
+
+        /**
+         * A function that returns the end iterator.
+         * @return Iterator - The iterator following the last token.
+         */
+        Iterator end() const { return Iterator(); }
+
+    private:
+        const Lexer& mLexer;        //< The lexer.
+        const std::string& mInput;  //< The input text.
+};
+
+#endif
\ No newline at end of file
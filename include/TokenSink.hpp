@@ -0,0 +1,29 @@
+#ifndef __TOKEN_SINK_HPP__
+#define __TOKEN_SINK_HPP__
+
+#include <type_traits>
+#include <utility>
+
+/**
+ * A trait indicating if a sink (see Lexer::lex) is an object with an onToken(int, const char*, const char*) member.
+ */
+template <typename Sink, typename = void>
+struct HasOnToken : std::false_type {};
+
+template <typename Sink>
+struct HasOnToken<Sink, std::void_t<decltype(std::declval<Sink&>().onToken(0, static_cast<const char*>(nullptr),
+                                                                           static_cast<const char*>(nullptr)))>>
+    : std::true_type {};
+
+/**
+ * A trait indicating if a sink (see Lexer::lex) has an onError(const char*, const char*) member.
+ */
+template <typename Sink, typename = void>
+struct HasOnError : std::false_type {};
+
+template <typename Sink>
+struct HasOnError<Sink, std::void_t<decltype(std::declval<Sink&>().onError(static_cast<const char*>(nullptr),
+                                                                           static_cast<const char*>(nullptr)))>>
+    : std::true_type {};
+
+#endif
\ No newline at end of file
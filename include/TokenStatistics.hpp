@@ -0,0 +1,18 @@
+#ifndef __TOKEN_STATISTICS_HPP__
+#define __TOKEN_STATISTICS_HPP__
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * TokenStatistics structure.
+ * Represents the number of tokens of each token id in an input, and optionally the distribution of their lengths.
+ */
+struct TokenStatistics {
+    static constexpr size_t HistogramSize = 64;     //< The number of buckets of a length histogram (the last one counts the longer tokens).
+
+    std::vector<size_t> counts;                     //< The number of tokens, indexed by token id.
+    std::vector<std::vector<size_t>> histograms;    //< The number of tokens of each length, indexed by token id (empty if not requested).
+};
+
+#endif
\ No newline at end of file
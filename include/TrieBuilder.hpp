@@ -0,0 +1,48 @@
+#ifndef __TRIE_BUILDER_HPP__
+#define __TRIE_BUILDER_HPP__
+
+#include <string>
+#include <vector>
+
+#include "NFA.hpp"
+
+/**
+ * A helper class. Used to build the DFA of a set of literal tokens (keywords, operators, ...).
+ */
+class TrieBuilder {
+    public:
+        /**
+         * A literal token.
+         */
+        struct Literal {
+            std::string text;   //< The characters of the token.
+            std::string type;   //< The token type.
+            int priority;       //< The token priority.
+        };
+
+        /**
+         * A function that builds the trie of a list of literals.
+         * The states and transitions are created directly, in O(L log L) for a total length L of the literals
+         * (the transitions are kept in a std::map): the trie is already deterministic, without empty transitions,
+         * so it can be given to a Lexer as is or combined with other lexics (see NFA::combine).
+         * A literal declared twice with the same type is rejected. When a text has several types, the one of
+         * highest priority is matched, and the first declared one between equal priorities.
+         * @param literals - std::vector<Literal> - The literals.
+         * @return NFA - The DFA recognizing the literals.
+         */
+        static NFA build(const std::vector<Literal>& literals);
+
+        /**
+         * A function that adds literals to an existing DFA, without going through NFA::combine and toDFA.
+         * The result is the product of the DFA and of the trie of the literals: its states are the pairs
+         * (DFA state, trie node) reached by some input, so there are at most as many states as in the DFA
+         * and the trie together. When a literal ties with a token of the DFA, the token of the DFA is matched.
+         * The keywords of the DFA are kept.
+         * @param dfa - NFA - The DFA, which must be deterministic.
+         * @param literals - std::vector<Literal> - The literals.
+         * @return NFA - The DFA recognizing the tokens of 'dfa' and the literals.
+         */
+        static NFA merge(const NFA& dfa, const std::vector<Literal>& literals);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include "CheckpointIndex.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+CheckpointIndex::CheckpointIndex(size_t interval) : mInterval(interval), mInputLength(0), mTokenCount(0), mCheckpoints{Checkpoint{0, 0}} {
+    if (mInterval == 0) {
+        throw std::runtime_error("The interval of a checkpoint index can't be 0");
+    }
+}
+
+void CheckpointIndex::record(size_t offset, size_t tokenIndex) {
+    if (offset >= mCheckpoints.back().offset + mInterval) {
+        mCheckpoints.push_back(Checkpoint{offset, tokenIndex});
+    }
+}
+
+void CheckpointIndex::finish(size_t inputLength, size_t tokenCount) {
+    mInputLength = inputLength;
+    mTokenCount = tokenCount;
+}
+
+const CheckpointIndex::Checkpoint& CheckpointIndex::checkpointForToken(size_t tokenIndex) const {
+    auto it = std::upper_bound(mCheckpoints.begin(), mCheckpoints.end(), tokenIndex,
+                               [](size_t index, const Checkpoint& checkpoint) {
+                                   return index < checkpoint.tokenIndex;
+                               });
+    return *std::prev(it);
+}
+
+const CheckpointIndex::Checkpoint& CheckpointIndex::checkpointForOffset(size_t offset) const {
+    auto it = std::upper_bound(mCheckpoints.begin(), mCheckpoints.end(), offset,
+                               [](size_t offset, const Checkpoint& checkpoint) {
+                                   return offset < checkpoint.offset;
+                               });
+    return *std::prev(it);
+}
+
+CheckpointIndex CheckpointIndex::loadFromFilename(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Can't open the index file " + filename);
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    json indexJson = json::from_cbor(data);
+
+    CheckpointIndex index(indexJson["interval"].get<size_t>());
+    index.finish(indexJson["inputLength"].get<size_t>(), indexJson["tokenCount"].get<size_t>());
+
+    // The checkpoints are stored as a flat list of (offset, token index) pairs
+    std::vector<size_t> values = indexJson["checkpoints"].get<std::vector<size_t>>();
+    if (values.size() % 2 != 0 || values.size() < 2 || values[0] != 0 || values[1] != 0) {
+        throw std::runtime_error("Invalid index file " + filename);
+    }
+    for (size_t i{2};i < values.size();i += 2) {
+        index.mCheckpoints.push_back(Checkpoint{values[i], values[i + 1]});
+    }
+    return index;
+}
+
+bool CheckpointIndex::saveToFile(const std::string& filename) const {
+    std::vector<size_t> values;
+    values.reserve(mCheckpoints.size() * 2);
+    for (const Checkpoint& checkpoint : mCheckpoints) {
+        values.push_back(checkpoint.offset);
+        values.push_back(checkpoint.tokenIndex);
+    }
+
+    json output;
+    output["interval"] = mInterval;
+    output["inputLength"] = mInputLength;
+    output["tokenCount"] = mTokenCount;
+    output["checkpoints"] = std::move(values);
+
+    std::ofstream file(filename, std::ios::binary);
+    std::vector<uint8_t> data = json::to_cbor(output);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return static_cast<bool>(file);
+}
\ No newline at end of file
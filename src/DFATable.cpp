@@ -0,0 +1,130 @@
+#include "DFATable.hpp"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+DFATable::DFATable() : mStartState(0) {
+}
+
+DFATable::DFATable(const NFA& dfa) : mStartState(0) {
+    if (!dfa.isDeterministic()) {
+        throw std::runtime_error("The NFA must be deterministic");
+    }
+
+    // Token ids are given in the alphabetical order of the token types
+    std::set<std::string> types;
+    for (const State& state : dfa.mStates) {
+        for (const TokenInfo& tokenInfo : state.payload) {
+            types.insert(tokenInfo.type);
+        }
+    }
+    for (const KeywordInfo& keyword : dfa.mKeywords) {
+        types.insert(keyword.type);
+    }
+    std::copy(types.begin(), types.end(), std::back_inserter(mTokenTypes));
+
+    // Resolve the token of each accepting state using the priorities
+    mTokens.resize(dfa.mStates.size(), -1);
+    for (size_t i{0};i < dfa.mStates.size();++i) {
+        const State& state = dfa.mStates.at(i);
+
+        if (state.isStarting) {
+            mStartState = i;
+        }
+
+        if (state.isAccepting && !state.payload.empty()) {
+            auto best = std::max_element(state.payload.begin(), state.payload.end(),
+                                         [](const TokenInfo& a, const TokenInfo& b) { return a.priority < b.priority; });
+            mTokens[i] = tokenId(best->type);
+        }
+    }
+
+    // Fill the dense transition table
+    mTransitions.resize(dfa.mStates.size() * 256, DeadState);
+    for (const auto& [key, to] : dfa.mCharacterTransitionTable) {
+        mTransitions[key.first * 256 + static_cast<unsigned char>(key.second)] = to;
+    }
+}
+
+int DFATable::tokenId(const std::string& type) const {
+    auto it = std::lower_bound(mTokenTypes.begin(), mTokenTypes.end(), type);
+    if (it == mTokenTypes.end() || *it != type) {
+        return -1;
+    }
+    return std::distance(mTokenTypes.begin(), it);
+}
+
+Match DFATable::match(const char* begin, const char* end) const {
+    Match result{0, 0, -1};
+    uint32_t state = mStartState;
+    const char* current = begin;
+
+    // Follow the transitions as long as possible, remembering the last accepting state
+    while (current != end) {
+        state = next(state, static_cast<unsigned char>(*current));
+        if (state == DeadState) {
+            break;
+        }
+        current++;
+
+        if (mTokens[state] >= 0) {
+            result.length = current - begin;
+            result.token = mTokens[state];
+        }
+    }
+
+    result.scanned = current - begin;
+    return result;
+}
+
+DFATable DFATable::minimized() const {
+    // Start with one block per token (and one for the non accepting states)
+    std::vector<uint32_t> blocks(stateCount());
+    std::map<int, uint32_t> initialBlocks;
+    for (uint32_t state{0};state < stateCount();++state) {
+        auto it = initialBlocks.emplace(mTokens[state], initialBlocks.size()).first;
+        blocks[state] = it->second;
+    }
+    size_t blockCount = initialBlocks.size();
+
+    // Split the blocks until all their states have equivalent transitions
+    while (true) {
+        std::map<std::vector<uint32_t>, uint32_t> signatures;
+        std::vector<uint32_t> newBlocks(stateCount());
+        std::vector<uint32_t> signature(257);
+
+        for (uint32_t state{0};state < stateCount();++state) {
+            signature[0] = blocks[state];
+            for (unsigned int c = 0;c < 256;++c) {
+                uint32_t target = next(state, c);
+                signature[c + 1] = (target == DeadState) ? DeadState : blocks[target];
+            }
+            auto it = signatures.emplace(signature, signatures.size()).first;
+            newBlocks[state] = it->second;
+        }
+
+        blocks = std::move(newBlocks);
+        if (signatures.size() == blockCount) {
+            break;
+        }
+        blockCount = signatures.size();
+    }
+
+    // Build the table of the blocks
+    DFATable table;
+    table.mTokenTypes = mTokenTypes;
+    table.mStartState = blocks[mStartState];
+    table.mTokens.resize(blockCount, -1);
+    table.mTransitions.resize(blockCount * 256, DeadState);
+    for (uint32_t state{0};state < stateCount();++state) {
+        uint32_t block = blocks[state];
+        table.mTokens[block] = mTokens[state];
+        for (unsigned int c = 0;c < 256;++c) {
+            uint32_t target = next(state, c);
+            table.mTransitions[block * 256 + c] = (target == DeadState) ? DeadState : blocks[target];
+        }
+    }
+
+    return table;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "InputChannel.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <utility>
+
+std::string InputChannel::Read::await_resume() {
+    if (mChannel.mChunks.empty()) {
+        return std::string();
+    }
+    std::string chunk = std::move(mChannel.mChunks.front());
+    mChannel.mChunks.pop_front();
+    return chunk;
+}
+
+InputChannel::InputChannel() : mClosed(false), mReader(nullptr) {
+}
+
+void InputChannel::push(std::string chunk) {
+    if (chunk.empty() || mClosed) {
+        return;
+    }
+    mChunks.push_back(std::move(chunk));
+    wakeReader();
+}
+
+void InputChannel::close() {
+    mClosed = true;
+    wakeReader();
+}
+
+void InputChannel::wakeReader() {
+    // The handle is cleared first, as the reader may wait again before resume() returns
+    if (std::coroutine_handle<> reader = std::exchange(mReader, nullptr)) {
+        reader.resume();
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "JITScanner.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__unix__)
+#define LEXER_JIT_AVAILABLE
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// The generated code writes the result fields directly
+static_assert(offsetof(Match, length) == 0, "Unexpected Match layout");
+static_assert(offsetof(Match, scanned) == 8, "Unexpected Match layout");
+static_assert(offsetof(Match, token) == 16, "Unexpected Match layout");
+
+namespace {
+
+/**
+ * A minimal assembler handling labels and 32 bits relative jumps.
+ */
+class Assembler {
+    public:
+        size_t newLabel() {
+            mLabels.push_back(SIZE_MAX);
+            return mLabels.size() - 1;
+        }
+
+        void bind(size_t label) {
+            mLabels[label] = mCode.size();
+        }
+
+        void emit(std::initializer_list<uint8_t> bytes) {
+            mCode.insert(mCode.end(), bytes.begin(), bytes.end());
+        }
+
+        void emit32(uint32_t value) {
+            for (size_t i{0};i < 4;++i) {
+                mCode.push_back((value >> (8 * i)) & 0xFF);
+            }
+        }
+
+        void jump(std::initializer_list<uint8_t> opcode, size_t label) {
+            emit(opcode);
+            mFixups.push_back(std::make_pair(mCode.size(), label));
+            emit32(0);
+        }
+
+        std::vector<uint8_t> finish() {
+            for (const auto& [offset, label] : mFixups) {
+                int32_t relative = static_cast<int32_t>(mLabels.at(label) - (offset + 4));
+                std::memcpy(mCode.data() + offset, &relative, sizeof(relative));
+            }
+            return std::move(mCode);
+        }
+
+    private:
+        std::vector<uint8_t> mCode;
+        std::vector<size_t> mLabels;
+        std::vector<std::pair<size_t, size_t>> mFixups;
+};
+
+/**
+ * A range of characters leading to the same state.
+ */
+struct Run {
+    unsigned int first;
+    unsigned int last;
+    uint32_t target;
+};
+
+/**
+ * Emits a binary search over the runs of a state. The character is in eax.
+ */
+void emitCompareTree(Assembler& assembler, const std::vector<Run>& runs, size_t from, size_t to,
+                     const std::vector<size_t>& entryLabels, size_t deadLabel) {
+    if (to - from <= 4) {
+        for (size_t i{from};i < to;++i) {
+            const Run& run = runs.at(i);
+            if (run.first == run.last) {
+                // cmp eax, imm32 ; je entry
+                assembler.emit({0x3D});
+                assembler.emit32(run.first);
+                assembler.jump({0x0F, 0x84}, entryLabels.at(run.target));
+            } else {
+                // mov r10d, eax ; sub r10d, first ; cmp r10d, last - first ; jbe entry
+                assembler.emit({0x41, 0x89, 0xC2});
+                assembler.emit({0x41, 0x81, 0xEA});
+                assembler.emit32(run.first);
+                assembler.emit({0x41, 0x81, 0xFA});
+                assembler.emit32(run.last - run.first);
+                assembler.jump({0x0F, 0x86}, entryLabels.at(run.target));
+            }
+        }
+        // jmp dead
+        assembler.jump({0xE9}, deadLabel);
+        return;
+    }
+
+    size_t middle = (from + to) / 2;
+    size_t lowerLabel = assembler.newLabel();
+
+    // cmp eax, imm32 ; jb lower
+    assembler.emit({0x3D});
+    assembler.emit32(runs.at(middle).first);
+    assembler.jump({0x0F, 0x82}, lowerLabel);
+
+    emitCompareTree(assembler, runs, middle, to, entryLabels, deadLabel);
+    assembler.bind(lowerLabel);
+    emitCompareTree(assembler, runs, from, middle, entryLabels, deadLabel);
+}
+
+}
+
+JITScanner::JITScanner(const DFATable& table) :
+    mTable(table), mCode(nullptr), mCodeSize(0), mFunction(nullptr) {
+#ifdef LEXER_JIT_AVAILABLE
+    std::vector<uint8_t> code = generate();
+
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t size = (code.size() + pageSize - 1) / pageSize * pageSize;
+
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return;
+    }
+
+    std::memcpy(memory, code.data(), code.size());
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(memory, size);
+        return;
+    }
+
+    mCode = memory;
+    mCodeSize = size;
+    mFunction = reinterpret_cast<ScanFunction>(memory);
+#endif
+}
+
+JITScanner::~JITScanner() {
+#ifdef LEXER_JIT_AVAILABLE
+    if (mCode != nullptr) {
+        munmap(mCode, mCodeSize);
+    }
+#endif
+}
+
+Match JITScanner::match(const char* begin, const char* end) const {
+    if (mFunction == nullptr) {
+        return mTable.match(begin, end);
+    }
+
+    Match result;
+    mFunction(begin, end, &result);
+    return result;
+}
+
+std::vector<uint8_t> JITScanner::generate() const {
+    // Register usage (System V calling convention):
+    //   rdi: current position       rsi: end of the input     rdx: pointer to the Match
+    //   rcx: start of the token     r8: last accepted position r9d: last accepted token
+    Assembler assembler;
+
+    size_t stateCount = mTable.stateCount();
+    std::vector<size_t> entryLabels(stateCount);
+    std::vector<size_t> bodyLabels(stateCount);
+    for (size_t i{0};i < stateCount;++i) {
+        entryLabels[i] = assembler.newLabel();
+        bodyLabels[i] = assembler.newLabel();
+    }
+    size_t doneLabel = assembler.newLabel();
+
+    // mov rcx, rdi ; mov r8, rdi ; mov r9d, -1 ; jmp start
+    assembler.emit({0x48, 0x89, 0xF9});
+    assembler.emit({0x49, 0x89, 0xF8});
+    assembler.emit({0x41, 0xB9});
+    assembler.emit32(0xFFFFFFFF);
+    assembler.jump({0xE9}, bodyLabels.at(mTable.startState()));
+
+    std::vector<Run> runs;
+    for (uint32_t state{0};state < stateCount;++state) {
+        // Entering a state consumes the character that led to it
+        assembler.bind(entryLabels[state]);
+        assembler.emit({0x48, 0xFF, 0xC7});             // inc rdi
+
+        int token = mTable.token(state);
+        if (token >= 0) {
+            assembler.emit({0x49, 0x89, 0xF8});         // mov r8, rdi
+            assembler.emit({0x41, 0xB9});               // mov r9d, token
+            assembler.emit32(token);
+        }
+
+        // Stop at the end of the input, otherwise read the next character
+        assembler.bind(bodyLabels[state]);
+        assembler.emit({0x48, 0x39, 0xF7});             // cmp rdi, rsi
+        assembler.jump({0x0F, 0x83}, doneLabel);        // jae done
+        assembler.emit({0x0F, 0xB6, 0x07});             // movzx eax, byte [rdi]
+
+        // Group the characters by target state
+        runs.clear();
+        for (unsigned int c = 0;c < 256;++c) {
+            uint32_t target = mTable.next(state, c);
+            if (target == DFATable::DeadState) {
+                continue;
+            }
+            if (!runs.empty() && runs.back().last + 1 == c && runs.back().target == target) {
+                runs.back().last = c;
+            } else {
+                runs.push_back(Run{c, c, target});
+            }
+        }
+
+        emitCompareTree(assembler, runs, 0, runs.size(), entryLabels, doneLabel);
+    }
+
+    // Write the result
+    assembler.bind(doneLabel);
+    assembler.emit({0x4C, 0x89, 0xC0});                 // mov rax, r8
+    assembler.emit({0x48, 0x29, 0xC8});                 // sub rax, rcx
+    assembler.emit({0x48, 0x89, 0x02});                 // mov [rdx], rax
+    assembler.emit({0x48, 0x89, 0xF8});                 // mov rax, rdi
+    assembler.emit({0x48, 0x29, 0xC8});                 // sub rax, rcx
+    assembler.emit({0x48, 0x89, 0x42, 0x08});           // mov [rdx + 8], rax
+    assembler.emit({0x44, 0x89, 0x4A, 0x10});           // mov [rdx + 16], r9d
+    assembler.emit({0xC3});                             // ret
+
+    return assembler.finish();
+}
\ No newline at end of file
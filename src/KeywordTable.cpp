@@ -0,0 +1,136 @@
+#include "KeywordTable.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint64_t FNVOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t FNVPrime = 1099511628211ull;
+constexpr uint32_t MaxDisplacement = 1 << 16;   // The number of displacements tried for a bucket before changing the seed
+
+/**
+ * Mixes the bits of a hash (the finalizer of splitmix64), to derive the bucket and the step from it.
+ */
+uint64_t mix(uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+size_t nextPowerOfTwo(size_t value) {
+    size_t power = 1;
+    while (power < value) {
+        power <<= 1;
+    }
+    return power;
+}
+
+}
+
+KeywordTable::KeywordTable() : mSeed(0) {
+}
+
+KeywordTable::KeywordTable(const std::vector<KeywordInfo>& keywords, const DFATable& table) : mSeed(0) {
+    if (keywords.empty()) {
+        return;
+    }
+
+    // Resolve the token ids
+    std::vector<Entry> entries;
+    mIsBase.assign(table.tokenCount(), 0);
+    for (const KeywordInfo& keyword : keywords) {
+        int baseToken = table.tokenId(keyword.baseType);
+        if (baseToken < 0) {
+            throw std::runtime_error("The base type " + keyword.baseType + " of the keyword " + keyword.text + " isn't in the lexic");
+        }
+        mIsBase[baseToken] = 1;
+        entries.push_back(Entry{keyword.text, baseToken, table.tokenId(keyword.type)});
+    }
+
+    // The table is kept at most half full, the buckets hold about 4 keywords
+    size_t slotCount = nextPowerOfTwo(entries.size() * 2);
+    size_t bucketCount = nextPowerOfTwo(entries.size() / 4 + 1);
+    size_t mask = slotCount - 1;
+
+    for (mSeed = 0;;++mSeed) {
+        std::vector<uint64_t> hashes(entries.size());
+        std::vector<std::vector<size_t>> buckets(bucketCount);
+        for (size_t i{0};i < entries.size();++i) {
+            hashes[i] = hash(mSeed, entries[i].baseToken, entries[i].text.data(), entries[i].text.size());
+            buckets[(mix(hashes[i]) >> 32) & (bucketCount - 1)].push_back(i);
+        }
+
+        // We place the largest buckets first, each with the first displacement moving all its keywords to free slots
+        std::vector<size_t> order(bucketCount);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<bool> used(slotCount, false);
+        mDisplacements.assign(bucketCount, 0);
+        bool placed = true;
+        for (size_t bucket : order) {
+            if (buckets[bucket].empty()) {
+                break;
+            }
+
+            placed = false;
+            for (uint32_t displacement = 0;displacement < MaxDisplacement && !placed;++displacement) {
+                std::vector<size_t> slots;
+                for (size_t i : buckets[bucket]) {
+                    size_t slot = (hashes[i] + displacement * (mix(hashes[i]) | 1)) & mask;
+                    if (used[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                        break;
+                    }
+                    slots.push_back(slot);
+                }
+                if (slots.size() == buckets[bucket].size()) {
+                    for (size_t slot : slots) {
+                        used[slot] = true;
+                    }
+                    mDisplacements[bucket] = displacement;
+                    placed = true;
+                }
+            }
+            if (!placed) {
+                break;
+            }
+        }
+        if (!placed) {
+            continue;
+        }
+
+        // Fill the slots
+        mEntries.assign(slotCount, Entry{std::string(), -1, -1});
+        for (size_t i{0};i < entries.size();++i) {
+            uint64_t displacement = mDisplacements[(mix(hashes[i]) >> 32) & (bucketCount - 1)];
+            mEntries[(hashes[i] + displacement * (mix(hashes[i]) | 1)) & mask] = entries[i];
+        }
+        return;
+    }
+}
+
+int KeywordTable::lookup(int token, const char* begin, size_t length) const {
+    uint64_t h = hash(mSeed, token, begin, length);
+    uint64_t mixed = mix(h);
+    uint64_t displacement = mDisplacements[(mixed >> 32) & (mDisplacements.size() - 1)];
+    const Entry& entry = mEntries[(h + displacement * (mixed | 1)) & (mEntries.size() - 1)];
+
+    if (entry.baseToken == token && entry.text.size() == length && std::memcmp(entry.text.data(), begin, length) == 0) {
+        return entry.token;
+    }
+    return token;
+}
+
+uint64_t KeywordTable::hash(uint64_t seed, int token, const char* begin, size_t length) {
+    uint64_t h = (FNVOffsetBasis ^ mix(seed)) + static_cast<uint64_t>(token);
+    for (size_t i{0};i < length;++i) {
+        h ^= static_cast<unsigned char>(begin[i]);
+        h *= FNVPrime;
+    }
+    return h;
+}
\ No newline at end of file
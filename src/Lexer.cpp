@@ -1,15 +1,62 @@
 #include "Lexer.hpp"
 #include "LexicalErrorException.hpp"
+#include "NumberParser.hpp"
 
-Lexer::Lexer(const NFA& nfa) :
-    mTraverser(nfa), mHasLastValidState(false),
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+
+namespace {
+
+/**
+ * Builds the minimized table of a lexic, determinizing it first if needed.
+ * @param nfa - NFA - The NFA of the lexic.
+ * @return DFATable - The minimized table.
+ */
+DFATable buildTable(const NFA& nfa) {
+    if (nfa.isDeterministic()) {
+        return DFATable(nfa).minimized();
+    }
+    return DFATable(nfa.toDFA()).minimized();
+}
+
+}
+
+Lexer::Lexer(const NFA& nfa, Engine engine) :
+    mTraverser(nfa), mTable(buildTable(nfa)), mEngine(engine), mThreadedScanner(mTable), mSyncAnalysis(mTable),
+    mKeywords(nfa.keywords(), mTable), mHasLastValidState(false),
     mLastStartPosition(0), mCurrentPosition(0), mStartPosition(0) {
     mTempBuffer.reserve(1000);
+
+    if (mEngine == Engine::Auto || mEngine == Engine::Shuffle) {
+        mEngine = ShuffleScanner::isApplicable(mTable) ? Engine::Shuffle : Engine::Threaded;
+    }
+
+    // The JIT engine is resolved to the table when no code could be generated
+    if (mEngine == Engine::JIT) {
+        mJITScanner = std::make_unique<JITScanner>(mTable);
+        if (!mJITScanner->isCompiled()) {
+            mJITScanner.reset();
+            mEngine = Engine::Table;
+        }
+    } else if (mEngine == Engine::Shuffle) {
+        mShuffleScanner = std::make_unique<ShuffleScanner>(mTable);
+    }
 }
 
 std::vector<std::pair<std::string, std::string>> Lexer::extractTokens(const std::string& input) {
     std::vector<std::pair<std::string, std::string>> tokens;
 
+    if (mEngine != Engine::Traverser) {
+        scan(input, 0, input.length(), [this, &input, &tokens](size_t start, size_t length, int token) {
+            tokens.emplace_back(std::string(input, start, length), mTable.tokenType(token));
+        });
+        return tokens;
+    }
+
     while(mCurrentPosition < input.length()) {
         // Get the next character
         const CharType& c = input.at(mCurrentPosition);
@@ -33,7 +80,7 @@ std::vector<std::pair<std::string, std::string>> Lexer::extractTokens(const std:
             if (mCurrentPosition == input.length()) {
                 if (!mHasLastValidState) {
                     std::string unknownToken(input, mStartPosition, mCurrentPosition + 1 - mStartPosition);
-                    throw LexicalErrorException("\"" + unknownToken + "\" is not a valid token.");
+                    throw LexicalErrorException::unknownToken(unknownToken, mStartPosition);
                 }
 
                 tokens.push_back(getLastToken(input));
@@ -50,7 +97,7 @@ std::vector<std::pair<std::string, std::string>> Lexer::extractTokens(const std:
             } else {
                 if (!mHasLastValidState) {
                     std::string unknownToken(input, mStartPosition, mCurrentPosition + 1 - mStartPosition);
-                    throw LexicalErrorException("\"" + unknownToken + "\" is not a valid token.");
+                    throw LexicalErrorException::unknownToken(unknownToken, mStartPosition);
                 }
                 tokens.push_back(getLastToken(input));
             }
@@ -59,6 +106,459 @@ std::vector<std::pair<std::string, std::string>> Lexer::extractTokens(const std:
 
     return tokens;
 }
+
+std::vector<Token> Lexer::tokenize(const std::string& input) const {
+    std::vector<Token> tokens;
+    scan(input, 0, input.length(), [&tokens](size_t start, size_t length, int token) {
+        tokens.push_back(Token{start, length, token});
+    });
+    return tokens;
+}
+
+std::pair<bool, size_t> Lexer::validate(const std::string& input) const {
+    const char* data = input.data();
+    size_t startPosition = 0;
+
+    while (startPosition < input.length()) {
+        Match m = match(data + startPosition, data + input.length());
+
+        if (m.token >= 0) {
+            startPosition += m.length;
+        } else if (m.scanned == 0 && (data[startPosition] == ' ' || data[startPosition] == '\n')) {
+            startPosition++;
+        } else {
+            return std::make_pair(false, startPosition);
+        }
+    }
+
+    return std::make_pair(true, input.length());
+}
+
+TokenStatistics Lexer::count(const std::string& input, bool histograms) const {
+    TokenStatistics statistics;
+    statistics.counts.assign(mTable.tokenCount(), 0);
+
+    if (!histograms) {
+        scan(input, 0, input.length(), [&statistics](size_t, size_t, int token) {
+            statistics.counts[token]++;
+        });
+        return statistics;
+    }
+
+    statistics.histograms.assign(mTable.tokenCount(), std::vector<size_t>(TokenStatistics::HistogramSize, 0));
+    scan(input, 0, input.length(), [&statistics](size_t, size_t length, int token) {
+        statistics.counts[token]++;
+        statistics.histograms[token][std::min(length, TokenStatistics::HistogramSize - 1)]++;
+    });
+    return statistics;
+}
+
+std::vector<Token> Lexer::tokenizeWithRecovery(const std::string& input, const std::function<void(const Token&)>& onError) const {
+    std::vector<Token> tokens;
+    const char* data = input.data();
+    size_t startPosition = 0;
+
+    while (startPosition < input.length()) {
+        Match m = match(data + startPosition, data + input.length());
+
+        if (m.token >= 0) {
+            tokens.push_back(Token{startPosition, m.length, m.token});
+            startPosition += m.length;
+            continue;
+        }
+
+        if (m.scanned == 0 && (data[startPosition] == ' ' || data[startPosition] == '\n')) {
+            startPosition++;
+            continue;
+        }
+
+        size_t position = resynchronize(input, startPosition);
+        tokens.push_back(Token{startPosition, position - startPosition, ErrorToken});
+        if (onError) {
+            onError(tokens.back());
+        }
+        startPosition = position;
+    }
+
+    return tokens;
+}
+
+std::vector<Token> Lexer::tokenize(const std::string& input, CheckpointIndex& index) const {
+    std::vector<Token> tokens;
+    scan(input, 0, input.length(), [&tokens, &index](size_t start, size_t length, int token) {
+        index.record(start, tokens.size());
+        tokens.push_back(Token{start, length, token});
+    });
+    index.finish(input.length(), tokens.size());
+    return tokens;
+}
+
+std::vector<Token> Lexer::tokenizeRange(const std::string& input, const CheckpointIndex& index, size_t first, size_t last) const {
+    if (index.inputLength() != input.length()) {
+        throw std::runtime_error("The checkpoint index doesn't match the input");
+    }
+
+    std::vector<Token> tokens;
+    const CheckpointIndex::Checkpoint& checkpoint = index.checkpointForToken(first);
+    size_t tokenIndex = checkpoint.tokenIndex;
+    size_t startPosition = checkpoint.offset;
+
+    // The tokens before 'first' are lexed but not kept
+    auto emit = [&tokens, &tokenIndex, first](size_t start, size_t length, int token) {
+        if (tokenIndex >= first) {
+            tokens.push_back(Token{start, length, token});
+        }
+        tokenIndex++;
+    };
+    while (tokenIndex < last && startPosition < input.length()) {
+        startPosition = scanToken(input, startPosition, input.length(), emit);
+    }
+    return tokens;
+}
+
+std::vector<Token> Lexer::tokenizeBytes(const std::string& input, const CheckpointIndex& index, size_t begin, size_t end) const {
+    if (index.inputLength() != input.length()) {
+        throw std::runtime_error("The checkpoint index doesn't match the input");
+    }
+
+    std::vector<Token> tokens;
+    size_t startPosition = index.checkpointForOffset(begin).offset;
+    end = std::min(end, input.length());
+
+    auto emit = [&tokens, begin](size_t start, size_t length, int token) {
+        if (start + length > begin) {
+            tokens.push_back(Token{start, length, token});
+        }
+    };
+    while (startPosition < end) {
+        startPosition = scanToken(input, startPosition, input.length(), emit);
+    }
+    return tokens;
+}
+
+std::vector<Token> Lexer::tokenizeBytes(const std::string& input, size_t begin, size_t end) const {
+    std::vector<Token> tokens;
+    size_t startPosition = mSyncAnalysis.findTokenStart(mTable, input, begin);
+    end = std::min(end, input.length());
+
+    auto emit = [&tokens, begin](size_t start, size_t length, int token) {
+        if (start + length > begin) {
+            tokens.push_back(Token{start, length, token});
+        }
+    };
+    while (startPosition < end) {
+        startPosition = scanToken(input, startPosition, input.length(), emit);
+    }
+    return tokens;
+}
+
+std::vector<NumericToken> Lexer::tokenizeNumbers(const std::string& input, const std::string& integerType,
+                                                 const std::string& floatType) const {
+    std::vector<NumericToken> tokens;
+    int integerId = tokenId(integerType);
+    int floatId = tokenId(floatType);
+    const char* data = input.data();
+
+    scan(input, 0, input.length(), [&tokens, integerId, floatId, data](size_t start, size_t length, int token) {
+        NumericToken numericToken{Token{start, length, token}, NumericToken::Kind::None, 0, 0.0};
+        if (token == integerId) {
+            bool valid;
+            std::tie(valid, numericToken.integer) = NumberParser::parseInteger(data + start, data + start + length);
+            numericToken.kind = valid ? NumericToken::Kind::Integer : NumericToken::Kind::None;
+        } else if (token == floatId) {
+            bool valid;
+            std::tie(valid, numericToken.real) = NumberParser::parseFloat(data + start, data + start + length);
+            numericToken.kind = valid ? NumericToken::Kind::Float : NumericToken::Kind::None;
+        }
+        tokens.push_back(numericToken);
+    });
+    return tokens;
+}
+
+std::vector<SymbolToken> Lexer::tokenizeSymbols(const std::string& input, SymbolTable& symbols, size_t threadCount,
+                                                const std::string& identifierType) const {
+    int identifierId = tokenId(identifierType);
+    return parallelScan<SymbolToken>(input, threadCount,
+        [&symbols, identifierId](const std::string& input, size_t start, size_t length, int token) {
+            uint32_t symbol = SymbolTable::NoSymbol;
+            if (token == identifierId) {
+                symbol = symbols.intern(std::string_view(input).substr(start, length));
+            }
+            return SymbolToken{Token{start, length, token}, symbol};
+        });
+}
+
+void Lexer::tokenize(const std::string& input, TokenBuffer& buffer) const {
+    scan(input, 0, input.length(), [&buffer](size_t start, size_t length, int token) {
+        buffer.append(start, length, token);
+    });
+}
+
+#if defined(__cpp_impl_coroutine)
+TokenGenerator Lexer::generate(const std::string& input) const {
+    size_t position = 0;
+    while (true) {
+        auto [found, token] = nextToken(input, position);
+        if (!found) {
+            break;
+        }
+        position = token.offset + token.length;
+        co_yield token;
+    }
+}
+
+AsyncTokenGenerator Lexer::lexAsync(InputChannel& source) const {
+    std::string buffer;         // The part of the stream from the current token start
+    size_t bufferOffset = 0;    // The position of the buffer in the stream
+    size_t position = 0;        // The position of the current token start in the buffer
+    bool ended = false;
+
+    while (true) {
+        // The DFA can only stop before the end of the buffer or at the end of the stream
+        Match m{0, 0, -1};
+        if (position < buffer.length()) {
+            m = match(buffer.data() + position, buffer.data() + buffer.length());
+        }
+        if (!ended && position + m.scanned == buffer.length()) {
+            std::string chunk = co_await source.read();
+            if (chunk.empty()) {
+                ended = true;
+            } else {
+                buffer.erase(0, position);
+                bufferOffset += position;
+                position = 0;
+                buffer += chunk;
+            }
+            continue;
+        }
+        if (position == buffer.length()) {
+            break;
+        }
+
+        if (m.token >= 0) {
+            co_yield StreamedToken{Token{bufferOffset + position, m.length, m.token},
+                                   std::string_view(buffer).substr(position, m.length)};
+            position += m.length;
+        } else if (m.scanned == 0 && (buffer[position] == ' ' || buffer[position] == '\n')) {
+            position++;
+        } else {
+            std::string unknownToken(buffer, position, m.scanned + 1);
+            throw LexicalErrorException::unknownToken(unknownToken, bufferOffset + position);
+        }
+    }
+}
+#endif
+
+std::vector<Token> Lexer::tokenize(const SegmentedInput& input) const {
+    std::vector<Token> tokens;
+    size_t index = 0;
+    size_t startPosition = 0;
+
+    while (startPosition < input.length()) {
+        // Find the segment containing the token start (usually the current one)
+        if (startPosition < input.segmentOffset(index) ||
+            startPosition >= input.segmentOffset(index) + input.segment(index).size()) {
+            index = input.findSegment(startPosition);
+        }
+        std::string_view segment = input.segment(index);
+        size_t local = startPosition - input.segmentOffset(index);
+
+        // The selected engine is used inside the segment. Only when the DFA reaches the end of the
+        // segment is the token continued in the next segments, with the table.
+        Match m = match(segment.data() + local, segment.data() + segment.size());
+        if (local + m.scanned == segment.size() && index + 1 < input.segmentCount()) {
+            m = Match{0, 0, -1};
+            uint32_t state = mTable.startState();
+            size_t segmentIndex = index;
+            size_t position = local;
+            while (segmentIndex < input.segmentCount()) {
+                std::string_view current = input.segment(segmentIndex);
+                if (position == current.size()) {
+                    segmentIndex++;
+                    position = 0;
+                    continue;
+                }
+
+                state = mTable.next(state, static_cast<unsigned char>(current[position]));
+                if (state == DFATable::DeadState) {
+                    break;
+                }
+                position++;
+                m.scanned++;
+
+                if (mTable.token(state) >= 0) {
+                    m.length = m.scanned;
+                    m.token = mTable.token(state);
+                }
+            }
+
+            if (m.token >= 0 && !mKeywords.empty()) {
+                std::string lexeme = input.substr(startPosition, m.length);
+                m.token = mKeywords.classify(m.token, lexeme.data(), lexeme.length());
+            }
+        }
+
+        if (m.token >= 0) {
+            tokens.push_back(Token{startPosition, m.length, m.token});
+            startPosition += m.length;
+        } else if (m.scanned == 0 && (segment[local] == ' ' || segment[local] == '\n')) {
+            startPosition++;
+        } else {
+            throw LexicalErrorException::unknownToken(input.substr(startPosition, m.scanned + 1), startPosition);
+        }
+    }
+
+    return tokens;
+}
+
+std::vector<Token> Lexer::tokenize(const std::string& input, size_t threadCount) const {
+    return parallelScan<Token>(input, threadCount, [](const std::string&, size_t start, size_t length, int token) {
+        return Token{start, length, token};
+    });
+}
+
+std::vector<std::pair<std::string, std::string>> Lexer::extractTokens(const std::string& input, size_t threadCount) const {
+    return parallelScan<std::pair<std::string, std::string>>(input, threadCount,
+        [this](const std::string& input, size_t start, size_t length, int token) {
+            return std::make_pair(std::string(input, start, length), mTable.tokenType(token));
+        });
+}
+
+void Lexer::relex(std::vector<Token>& tokens, const std::string& input, const TextEdit& edit) const {
+    auto byOffset = [](const Token& token, size_t offset) { return token.offset < offset; };
+    auto tokenEnd = [&tokens](size_t index) { return tokens[index].offset + tokens[index].length; };
+
+    // The tokens before the last sync point can't have read the edited characters. Neither can the
+    // tokens whose scan is shorter than the distance to the edit.
+    size_t safeLimit = mSyncAnalysis.previousSyncPoint(input, edit.offset);
+    if (mSyncAnalysis.maxScanLength() < edit.offset) {
+        safeLimit = std::max(safeLimit, edit.offset - mSyncAnalysis.maxScanLength());
+    }
+    size_t first = std::lower_bound(tokens.begin(), tokens.end(), safeLimit, byOffset) - tokens.begin();
+
+    // The characters before the edit are unchanged: check what the remaining tokens actually read
+    while (first < tokens.size() && tokens[first].offset < edit.offset) {
+        Match m = match(input.data() + tokens[first].offset, input.data() + input.length());
+        if (tokens[first].offset + m.scanned >= edit.offset) {
+            break;
+        }
+        first++;
+    }
+
+    // Lex again until reaching a position where the previous lexing looked for a token: a token start
+    // or a skipped separator between two tokens
+    long long delta = static_cast<long long>(edit.insertedLength) - static_cast<long long>(edit.removedLength);
+    size_t editEnd = edit.offset + edit.insertedLength;
+    std::vector<Token> newTokens;
+    auto emit = [&newTokens](size_t start, size_t length, int token) {
+        newTokens.push_back(Token{start, length, token});
+    };
+
+    size_t position = (first > 0) ? tokenEnd(first - 1) : 0;
+    size_t last = tokens.size();
+    while (position < input.length()) {
+        if (position >= editEnd) {
+            size_t oldPosition = position - delta;
+            size_t next = std::lower_bound(tokens.begin() + first, tokens.end(), oldPosition, byOffset) - tokens.begin();
+            size_t gapStart = (next > 0) ? tokenEnd(next - 1) : 0;
+            if (gapStart <= oldPosition) {
+                last = next;
+                break;
+            }
+        }
+        position = scanToken(input, position, input.length(), emit);
+    }
+
+    // Splice the new tokens and shift the following ones
+    for (size_t i{last};i < tokens.size();++i) {
+        tokens[i].offset += delta;
+    }
+    tokens.erase(tokens.begin() + first, tokens.begin() + last);
+    tokens.insert(tokens.begin() + first, newTokens.begin(), newTokens.end());
+}
+
+std::vector<std::vector<std::pair<std::string, std::string>>> Lexer::extractTokens(const std::vector<std::string>& inputs) const {
+    // The state of the lexing of one input
+    struct Lane {
+        const std::string* input;
+        size_t index;
+        size_t startPosition;
+        size_t position;
+        size_t lastAcceptPosition;
+        int lastToken;
+        uint32_t state;
+    };
+
+    std::vector<std::vector<std::pair<std::string, std::string>>> tokens(inputs.size());
+    std::array<Lane, BatchLanes> lanes;
+    size_t activeLanes = 0;
+    size_t nextInput = 0;
+
+    // Gives the next non empty input to a lane, returns false if there are no more inputs
+    auto assign = [this, &inputs, &nextInput](Lane& lane) {
+        while (nextInput < inputs.size() && inputs[nextInput].empty()) {
+            nextInput++;
+        }
+        if (nextInput == inputs.size()) {
+            return false;
+        }
+        lane = Lane{&inputs[nextInput], nextInput, 0, 0, 0, -1, mTable.startState()};
+        nextInput++;
+        return true;
+    };
+
+    while (activeLanes < BatchLanes && assign(lanes[activeLanes])) {
+        activeLanes++;
+    }
+
+    while (activeLanes > 0) {
+        // Advance every lane by one character. The lanes are independent, so their table
+        // loads are in flight at the same time.
+        for (size_t i{0};i < activeLanes;++i) {
+            Lane& lane = lanes[i];
+            const std::string& input = *lane.input;
+
+            if (lane.position < input.length()) {
+                uint32_t next = mTable.next(lane.state, static_cast<unsigned char>(input[lane.position]));
+                if (next != DFATable::DeadState) {
+                    lane.state = next;
+                    lane.position++;
+                    if (mTable.token(next) >= 0) {
+                        lane.lastAcceptPosition = lane.position;
+                        lane.lastToken = mTable.token(next);
+                    }
+                    continue;
+                }
+            }
+
+            // The DFA stopped: emit the longest match and restart after it
+            if (lane.lastToken >= 0) {
+                size_t length = lane.lastAcceptPosition - lane.startPosition;
+                int token = mKeywords.classify(lane.lastToken, input.data() + lane.startPosition, length);
+                tokens[lane.index].emplace_back(std::string(input, lane.startPosition, length), mTable.tokenType(token));
+                lane.startPosition = lane.lastAcceptPosition;
+            } else if (lane.position == lane.startPosition &&
+                       (input[lane.position] == ' ' || input[lane.position] == '\n')) {
+                lane.startPosition++;
+            } else {
+                std::string unknownToken(input, lane.startPosition, lane.position + 1 - lane.startPosition);
+                throw LexicalErrorException::unknownToken(unknownToken, lane.startPosition);
+            }
+            lane.position = lane.startPosition;
+            lane.lastToken = -1;
+            lane.state = mTable.startState();
+
+            // Once its input is done, the lane takes the next one or is removed
+            if (lane.startPosition == input.length() && !assign(lane)) {
+                lane = lanes[--activeLanes];
+                i--;
+            }
+        }
+    }
+
+    return tokens;
+}
+
 //*
 std::pair<bool, std::pair<std::string, std::string>> Lexer::next(const std::string& stream) {
     bool stateFound = false;
@@ -107,7 +607,7 @@ std::pair<bool, std::pair<std::string, std::string>> Lexer::next(const std::stri
                 // !! Not tested !!
                 if (!mHasLastValidState) {
                     std::string unknownToken(stream, mStartPosition, mCurrentPosition + 1 - mStartPosition);
-                    throw LexicalErrorException("\"" + unknownToken + "\" is not a valid token.");
+                    throw LexicalErrorException::unknownToken(unknownToken, mStartPosition);
                 }
 
                 returnedValue = getLastToken(stream);
@@ -122,13 +622,16 @@ std::pair<bool, std::pair<std::string, std::string>> Lexer::next(const std::stri
 
 std::pair<std::string, std::string> Lexer::getLastToken(const std::string& input) {
     std::string newToken(input, mStartPosition, mLastStartPosition - mStartPosition);
+    // As in DFATable, the first token of highest priority is chosen (whatever its priority)
     std::string tokenType;
-    size_t priority{0};
-    for (const auto& e : mLastValidState.payload) {
-        if (e.priority > priority) {
-            priority = e.priority;
-            tokenType = e.type;
-        }
+    auto best = std::max_element(mLastValidState.payload.begin(), mLastValidState.payload.end(),
+                                 [](const TokenInfo& a, const TokenInfo& b) { return a.priority < b.priority; });
+    if (best != mLastValidState.payload.end()) {
+        tokenType = best->type;
+    }
+    int token = mTable.tokenId(tokenType);
+    if (token >= 0 && !mKeywords.empty()) {
+        tokenType = mTable.tokenType(mKeywords.classify(token, newToken.data(), newToken.length()));
     }
     mCurrentPosition = mLastStartPosition;
     mStartPosition = mLastStartPosition;
@@ -136,4 +639,259 @@ std::pair<std::string, std::string> Lexer::getLastToken(const std::string& input
     mTraverser.reset();
 
     return std::make_pair(newToken, tokenType);
+}
+
+std::pair<bool, Token> Lexer::nextToken(const std::string& input, size_t position) const {
+    bool found = false;
+    Token token{0, 0, -1};
+    auto emit = [&found, &token](size_t start, size_t length, int id) {
+        token = Token{start, length, id};
+        found = true;
+    };
+
+    // Separators are skipped until a token is found
+    while (!found && position < input.length()) {
+        position = scanToken(input, position, input.length(), emit);
+    }
+    return std::make_pair(found, token);
+}
+
+size_t Lexer::resynchronize(const std::string& input, size_t startPosition) const {
+    // We resynchronize on the next character that starts a token or is a separator
+    size_t position = startPosition + 1;
+    while (position < input.length()) {
+        unsigned char c = static_cast<unsigned char>(input[position]);
+        if (mSyncAnalysis.canStartToken(c) || c == ' ' || c == '\n') {
+            break;
+        }
+        position++;
+    }
+    return position;
+}
+
+void Lexer::throwUnknownToken(const std::string& input, size_t startPosition, size_t scanned) const {
+    throw LexicalErrorException::unknownToken(std::string_view(input).substr(startPosition, scanned + 1), startPosition);
+}
+
+Match Lexer::match(const char* begin, const char* end) const {
+    Match m;
+    switch (mEngine) {
+        case Engine::Threaded:
+            m = mThreadedScanner.match(begin, end);
+            break;
+        case Engine::JIT:
+            m = mJITScanner->match(begin, end);
+            break;
+        case Engine::Shuffle:
+            m = mShuffleScanner->match(begin, end);
+            break;
+        default:
+            m = mTable.match(begin, end);
+            break;
+    }
+
+    // The keywords are matched as their base token type
+    m.token = mKeywords.classify(m.token, begin, m.length);
+    return m;
+}
+
+template <typename Emit>
+void Lexer::scan(const std::string& input, size_t from, size_t to, Emit&& emit) const {
+    size_t startPosition = from;
+    while (startPosition < to) {
+        startPosition = scanToken(input, startPosition, to, emit);
+    }
+}
+
+template <typename Emit>
+size_t Lexer::scanToken(const std::string& input, size_t startPosition, size_t to, Emit&& emit) const {
+    const char* data = input.data();
+    Match m = match(data + startPosition, data + to);
+
+    if (m.token >= 0) {
+        emit(startPosition, m.length, m.token);
+        return startPosition + m.length;
+    }
+
+    // Separators are skipped when they can't start a token
+    if (m.scanned == 0 && (data[startPosition] == ' ' || data[startPosition] == '\n')) {
+        return startPosition + 1;
+    }
+
+    throwUnknownToken(input, startPosition, m.scanned);
+}
+
+template <typename T, typename MakeToken>
+std::vector<T> Lexer::parallelScan(const std::string& input, size_t threadCount, MakeToken makeToken) const {
+    // Small chunks are not worth a thread
+    static constexpr size_t MinimumChunkSize = 1 << 16;
+
+    if (threadCount == 0) {
+        threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threadCount = std::min(threadCount, std::max<size_t>(input.length() / MinimumChunkSize, 1));
+
+    // Without sync characters, the chunks have to be lexed speculatively
+    if (!mSyncAnalysis.hasSyncCharacters() && threadCount > 1) {
+        std::vector<Token> tokens = tokenizeSpeculative(input, threadCount);
+        std::vector<T> result;
+        result.reserve(tokens.size());
+        for (const Token& token : tokens) {
+            result.push_back(makeToken(input, token.offset, token.length, token.type));
+        }
+        return result;
+    }
+
+    // Cut the input in roughly equal chunks, each boundary being moved to the next sync point
+    std::vector<size_t> boundaries = {0};
+    if (mSyncAnalysis.hasSyncCharacters()) {
+        for (size_t i{1};i < threadCount;++i) {
+            size_t boundary = std::max(input.length() * i / threadCount, boundaries.back());
+            boundary = mSyncAnalysis.nextSyncPoint(input, boundary, input.length());
+            if (boundary == std::string::npos) {
+                break;
+            }
+            if (boundary > boundaries.back()) {
+                boundaries.push_back(boundary);
+            }
+        }
+    }
+    boundaries.push_back(input.length());
+
+    // Lex the chunks concurrently
+    size_t chunkCount = boundaries.size() - 1;
+    std::vector<std::vector<T>> chunkTokens(chunkCount);
+    std::vector<std::exception_ptr> errors(chunkCount);
+    auto lexChunk = [&](size_t chunk) {
+        try {
+            scan(input, boundaries[chunk], boundaries[chunk + 1], [&](size_t start, size_t length, int token) {
+                chunkTokens[chunk].push_back(makeToken(input, start, length, token));
+            });
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t chunk{1};chunk < chunkCount;++chunk) {
+        threads.emplace_back(lexChunk, chunk);
+    }
+    lexChunk(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // The first error of the input is reported
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Concatenate the tokens of the chunks
+    size_t tokenCount{0};
+    for (const std::vector<T>& tokens : chunkTokens) {
+        tokenCount += tokens.size();
+    }
+    std::vector<T> tokens = std::move(chunkTokens[0]);
+    tokens.reserve(tokenCount);
+    for (size_t chunk{1};chunk < chunkCount;++chunk) {
+        std::move(chunkTokens[chunk].begin(), chunkTokens[chunk].end(), std::back_inserter(tokens));
+    }
+
+    return tokens;
+}
+
+std::vector<Token> Lexer::tokenizeSpeculative(const std::string& input, size_t threadCount) const {
+    // The result of lexing a chunk, assuming a token starts at its beginning
+    struct Speculation {
+        std::vector<Token> tokens;
+        std::vector<size_t> attempts;       // The positions where a token was looked for
+        std::exception_ptr error;           // The error raised at the last attempt, if any
+        size_t end;                         // The first attempt position after the chunk
+    };
+
+    if (threadCount == 0) {
+        threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threadCount = std::max<size_t>(std::min(threadCount, input.length()), 1);
+
+    std::vector<size_t> boundaries;
+    for (size_t i{0};i <= threadCount;++i) {
+        boundaries.push_back(input.length() * i / threadCount);
+    }
+
+    // When the runs of the lexer converge after a bounded number of characters, each speculation starts
+    // that many characters before its chunk: it then agrees with the real lexing from the chunk start
+    // (unless a token is invalid), and nothing is re-lexed when stitching.
+    size_t overlap = mSyncAnalysis.convergenceLength();
+    if (overlap > input.length() / threadCount) {
+        overlap = 0;
+    }
+
+    // Lex every chunk concurrently. Only the first chunk is known to start at a token.
+    std::vector<Speculation> speculations(threadCount);
+    auto speculate = [&](size_t chunk) {
+        Speculation& speculation = speculations[chunk];
+        auto emit = [&speculation](size_t start, size_t length, int token) {
+            speculation.tokens.push_back(Token{start, length, token});
+        };
+
+        size_t position = boundaries[chunk] - std::min(overlap, boundaries[chunk]);
+        while (position < boundaries[chunk + 1]) {
+            speculation.attempts.push_back(position);
+            try {
+                position = scanToken(input, position, input.length(), emit);
+            } catch (...) {
+                speculation.error = std::current_exception();
+                break;
+            }
+        }
+        speculation.end = position;
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t chunk{1};chunk < threadCount;++chunk) {
+        threads.emplace_back(speculate, chunk);
+    }
+    speculate(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Stitch the chunks in order. The lexer state between two tokens is only the position of the
+    // next attempt, so once the real lexing reaches an attempt of a speculation, the rest of the
+    // speculation is correct.
+    std::vector<Token> tokens;
+    auto emit = [&tokens](size_t start, size_t length, int token) {
+        tokens.push_back(Token{start, length, token});
+    };
+    size_t position = 0;
+
+    for (size_t chunk{0};chunk < threadCount;++chunk) {
+        Speculation& speculation = speculations[chunk];
+
+        // Re-lex until the speculation is reached (or the chunk is exhausted)
+        auto attempt = std::lower_bound(speculation.attempts.begin(), speculation.attempts.end(), position);
+        while (position < boundaries[chunk + 1] &&
+               (attempt == speculation.attempts.end() || *attempt != position)) {
+            position = scanToken(input, position, input.length(), emit);
+            attempt = std::lower_bound(attempt, speculation.attempts.end(), position);
+        }
+
+        if (attempt == speculation.attempts.end() || *attempt != position) {
+            continue;
+        }
+
+        // Synchronized: keep the speculated tokens from this position
+        auto first = std::lower_bound(speculation.tokens.begin(), speculation.tokens.end(), position,
+                                      [](const Token& token, size_t offset) { return token.offset < offset; });
+        tokens.insert(tokens.end(), first, speculation.tokens.end());
+        if (speculation.error) {
+            std::rethrow_exception(speculation.error);
+        }
+        position = speculation.end;
+    }
+
+    return tokens;
 }
\ No newline at end of file
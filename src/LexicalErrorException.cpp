@@ -1,3 +1,16 @@
 #include "LexicalErrorException.hpp"
 
-LexicalErrorException::LexicalErrorException(const std::string& msg) : std::runtime_error(msg) {} 
\ No newline at end of file
+LexicalErrorException::LexicalErrorException(const std::string& msg) : std::runtime_error(msg), mOffset(SIZE_MAX) {}
+
+LexicalErrorException::LexicalErrorException(const std::string& msg, size_t offset) : std::runtime_error(msg), mOffset(offset) {}
+
+LexicalErrorException LexicalErrorException::unknownToken(std::string_view unknownToken, size_t offset) {
+    return LexicalErrorException("\"" + std::string(unknownToken) + "\" is not a valid token.", offset);
+}
+
+LineIndex::Position LexicalErrorException::position(std::string_view input) const {
+    if (mOffset > input.length()) {
+        return LineIndex::Position{0, 0};
+    }
+    return LineIndex(input.substr(0, mOffset)).position(mOffset);
+}
\ No newline at end of file
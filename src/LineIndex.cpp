@@ -0,0 +1,57 @@
+#include "LineIndex.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+LineIndex::LineIndex() : mLength(0) {
+}
+
+LineIndex::LineIndex(std::string_view text) : mLength(0) {
+    append(text);
+}
+
+void LineIndex::append(std::string_view text) {
+    const char* data = text.data();
+    size_t length = text.size();
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    // We compare 16 bytes at a time with '\n' and walk the bits of the resulting mask
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (;i + 16 <= length;i += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+        while (mask != 0) {
+            mNewlines.push_back(mLength + i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // The tail (or the whole text without SSE2) is scanned with memchr
+    while (i < length) {
+        const void* found = std::memchr(data + i, '\n', length - i);
+        if (found == nullptr) {
+            break;
+        }
+        i = static_cast<const char*>(found) - data;
+        mNewlines.push_back(mLength + i);
+        i++;
+    }
+
+    mLength += length;
+}
+
+LineIndex::Position LineIndex::position(size_t offset) const {
+    // The line of an offset is the number of newlines before it
+    size_t line = std::distance(mNewlines.begin(), std::lower_bound(mNewlines.begin(), mNewlines.end(), offset));
+    return Position{line + 1, offset - lineOffset(line + 1) + 1};
+}
+
+size_t LineIndex::lineOffset(size_t line) const {
+    return (line <= 1) ? 0 : mNewlines.at(line - 2) + 1;
+}
\ No newline at end of file
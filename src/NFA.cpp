@@ -28,6 +28,27 @@ NFA::NFA(const Alphabet& alphabet,
 
 // Public methods
 
+void NFA::addKeyword(const KeywordInfo& keyword) {
+    auto it = std::find_if(mKeywords.begin(), mKeywords.end(), [&keyword](const KeywordInfo& k) {
+        return k.text == keyword.text && k.baseType == keyword.baseType;
+    });
+    if (it != mKeywords.end()) {
+        throw std::runtime_error("The keyword " + keyword.text + " already exists");
+    }
+
+    mKeywords.push_back(keyword);
+}
+
+bool NFA::isDeterministic() const {
+    bool hasEmptyTransitions = std::any_of(mEmptyTransitionTable.begin(), mEmptyTransitionTable.end(),
+                                           [](const std::pair<const size_t, std::vector<size_t>>& entry) {
+                                               return !entry.second.empty();
+                                           });
+    size_t startingStateCount = std::count_if(mStates.begin(), mStates.end(),
+                                              [](const State& state) { return state.isStarting; });
+    return !hasEmptyTransitions && startingStateCount == 1;
+}
+
 void NFA::addState(const State& state) {
     if (exists(state)) {
         throw std::runtime_error("This states already exists");
@@ -189,7 +210,9 @@ std::set<State> NFA::epsilonClosure(const std::set<State>& states) const {
 
     // While there are not marked states
     while (it != markedStatesSet.end()) {
+        // We set this state as marked before adding states, which invalidates the iterator
         size_t stateIndex = it->first;
+        it->second = true;
 
         // We get the list or reachable states if it exists
         auto reachableIt = mEmptyTransitionTable.find(stateIndex);
@@ -206,9 +229,7 @@ std::set<State> NFA::epsilonClosure(const std::set<State>& states) const {
                 }
         }
 
-        // We set this state as marked and look for another state to explore
-        it->second = true;
-
+        // We look for another state to explore
         it = std::find_if_not(markedStatesSet.begin(), markedStatesSet.end(), isStateMarked);
     }
 
@@ -235,7 +256,9 @@ std::set<State> NFA::epsilonClosure(const std::set<size_t>& states) const {
 
     // While there are not marked states
     while (it != markedStatesSet.end()) {
+        // We set this state as marked before adding states, which invalidates the iterator
         size_t stateIndex = it->first;
+        it->second = true;
 
         // We get the list or reachable states if it exists
         auto reachableIt = mEmptyTransitionTable.find(stateIndex);
@@ -252,9 +275,7 @@ std::set<State> NFA::epsilonClosure(const std::set<size_t>& states) const {
                 }
         }
 
-        // We set this state as marked and look for another state to explore
-        it->second = true;
-
+        // We look for another state to explore
         it = std::find_if_not(markedStatesSet.begin(), markedStatesSet.end(), isStateMarked);
     }
 
@@ -287,7 +308,9 @@ std::set<size_t> NFA::epsilonClosureIndex(const std::set<State>& states) const {
 
     // While there are not marked states
     while (it != markedStatesSet.end()) {
+        // We set this state as marked before adding states, which invalidates the iterator
         size_t stateIndex = it->first;
+        it->second = true;
 
         // We get the list or reachable states if it exists
         auto reachableIt = mEmptyTransitionTable.find(stateIndex);
@@ -304,9 +327,7 @@ std::set<size_t> NFA::epsilonClosureIndex(const std::set<State>& states) const {
                 }
         }
 
-        // We set this state as marked and look for another state to explore
-        it->second = true;
-
+        // We look for another state to explore
         it = std::find_if_not(markedStatesSet.begin(), markedStatesSet.end(), isStateMarked);
     }
 
@@ -336,7 +357,9 @@ std::set<size_t> NFA::epsilonClosureIndex(const std::set<size_t>& states) const
 
     // While there are not marked states
     while (it != markedStatesSet.end()) {
+        // We set this state as marked before adding states, which invalidates the iterator
         size_t stateIndex = it->first;
+        it->second = true;
 
         // We get the list or reachable states if it exists
         auto reachableIt = mEmptyTransitionTable.find(stateIndex);
@@ -353,9 +376,7 @@ std::set<size_t> NFA::epsilonClosureIndex(const std::set<size_t>& states) const
                 }
         }
 
-        // We set this state as marked and look for another state to explore
-        it->second = true;
-
+        // We look for another state to explore
         it = std::find_if_not(markedStatesSet.begin(), markedStatesSet.end(), isStateMarked);
     }
 
@@ -422,7 +443,59 @@ NFA NFA::toDFA() const {
     std::vector<State> states = computeNewStates(markedStateSetsSet);
 
     // Return a NFA which is a DFA
-    return NFA(mAlphabet, states, newCharacterTransitionTable);
+    NFA dfa(mAlphabet, states, newCharacterTransitionTable);
+    dfa.mKeywords = mKeywords;
+    return dfa;
+}
+
+NFA NFA::reverse() const {
+    std::vector<State> states;
+    std::map<std::pair<size_t, CharType>, size_t> characterTransitionTable;
+    std::map<size_t, std::vector<size_t>> emptyTransitionTable;
+
+    // The new starting state, leading to the former accepting states
+    states.push_back(State("R", false, true));
+    emptyTransitionTable.insert(std::make_pair(0, std::vector<size_t>()));
+
+    // The former states are shifted by one, the starting states becoming the accepting ones
+    for (size_t i{0};i < mStates.size();++i) {
+        const State& state = mStates.at(i);
+        State newState("R-" + state.name, state.isStarting, false);
+        if (state.isStarting) {
+            newState.payload.push_back(TokenInfo{"TOKEN_START", 0});
+        }
+        if (state.isAccepting) {
+            emptyTransitionTable.at(0).push_back(i + 1);
+        }
+        states.push_back(newState);
+    }
+
+    // Reverse the empty transitions
+    for (const auto& [from, toList] : mEmptyTransitionTable) {
+        for (const size_t& to : toList) {
+            emptyTransitionTable[to + 1].push_back(from + 1);
+        }
+    }
+
+    // Reverse the character transitions. Several states may lead to the same state with the same
+    // character: since a character transition has a single target, the extra ones go through a new
+    // state reached by an empty transition.
+    for (const auto& [key, to] : mCharacterTransitionTable) {
+        size_t newFrom = to + 1;
+        const CharType& character = key.second;
+        size_t newTo = key.first + 1;
+
+        if (characterTransitionTable.find(std::make_pair(newFrom, character)) == characterTransitionTable.end()) {
+            characterTransitionTable.insert(std::make_pair(std::make_pair(newFrom, character), newTo));
+        } else {
+            size_t intermediate = states.size();
+            states.push_back(State("R#" + std::to_string(intermediate)));
+            emptyTransitionTable[newFrom].push_back(intermediate);
+            characterTransitionTable.insert(std::make_pair(std::make_pair(intermediate, character), newTo));
+        }
+    }
+
+    return NFA(mAlphabet, states, characterTransitionTable, emptyTransitionTable);
 }
 
 // Private methods
@@ -544,5 +617,11 @@ NFA NFA::combine(const std::vector<NFA>& nfas) {
     std::string alphabet;
     std::copy(alphabetSet.begin(), alphabetSet.end(), std::back_inserter(alphabet));
 
-    return NFA(alphabet, newStates, characterTransitionTable, emptyTransitionTable);
+    NFA combined(alphabet, newStates, characterTransitionTable, emptyTransitionTable);
+    for (const auto& nfa : nfas) {
+        for (const KeywordInfo& keyword : nfa.mKeywords) {
+            combined.addKeyword(keyword);
+        }
+    }
+    return combined;
 }
\ No newline at end of file
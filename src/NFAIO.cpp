@@ -54,6 +54,16 @@ NFA NFAIO::loadFromFilename(const std::string& filename) {
                           nfa.addTransitions(from, characters, to);
                       }
                   });
+
+    // Get the keywords (optional)
+    if (lexicJson.find("keywords") != lexicJson.end()) {
+        std::for_each(lexicJson["keywords"].begin(), lexicJson["keywords"].end(),
+                      [&nfa](const json& e) {
+                          nfa.addKeyword(KeywordInfo{e["text"].get<std::string>(),
+                                                     e["type"].get<std::string>(),
+                                                     e["base"].get<std::string>()});
+                      });
+    }
     
     return nfa;
 }
@@ -156,6 +166,21 @@ bool NFAIO::saveToFile(const NFA& nfa, const std::string& filename) {
     
     output["tokensInfo"] = tokensInfo;
 
+    // Create the list of keywords
+    if (!nfa.mKeywords.empty()) {
+        std::vector<json> keywords(nfa.mKeywords.size());
+        std::transform(nfa.mKeywords.begin(), nfa.mKeywords.end(),
+                       keywords.begin(),
+                       [](const KeywordInfo& keyword) {
+                           json jsonKeyword;
+                           jsonKeyword["text"] = keyword.text;
+                           jsonKeyword["type"] = keyword.type;
+                           jsonKeyword["base"] = keyword.baseType;
+                           return jsonKeyword;
+                       });
+        output["keywords"] = keywords;
+    }
+
     std::ofstream outputStream(filename);
     outputStream << std::setw(4) << output;
 
@@ -0,0 +1,119 @@
+#include "NumberParser.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+// The powers of ten that are exact doubles
+constexpr double ExactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+constexpr uint64_t MaxExactMantissa = uint64_t(1) << 53;   // The largest integer such that all the smaller ones are exact doubles
+constexpr size_t MaxMantissaDigits = 19;                    // The number of digits that always fit in 64 bits
+
+/**
+ * Converts a float with the standard library (used when the fast path doesn't apply).
+ */
+std::pair<bool, double> slowParseFloat(const char* begin, const char* end) {
+#if defined(__cpp_lib_to_chars)
+    double value = 0.0;
+    std::from_chars_result result = std::from_chars(begin, end, value);
+    return std::make_pair(result.ec == std::errc() && result.ptr == end, value);
+#else
+    std::string lexeme(begin, end);
+    errno = 0;
+    char* parsedEnd = nullptr;
+    double value = std::strtod(lexeme.c_str(), &parsedEnd);
+    return std::make_pair(errno == 0 && parsedEnd == lexeme.c_str() + lexeme.length(), value);
+#endif
+}
+
+}
+
+std::pair<bool, uint64_t> NumberParser::parseInteger(const char* begin, const char* end) {
+    uint64_t value = 0;
+    for (const char* it = begin;it != end;++it) {
+        uint64_t digit = static_cast<uint64_t>(*it - '0');
+        if (digit > 9 || value > (UINT64_MAX - digit) / 10) {
+            return std::make_pair(false, uint64_t(0));
+        }
+        value = value * 10 + digit;
+    }
+    return std::make_pair(begin != end, value);
+}
+
+std::pair<bool, double> NumberParser::parseFloat(const char* begin, const char* end) {
+    // Read the mantissa, remembering the number of digits after the dot
+    uint64_t mantissa = 0;
+    size_t digits = 0;
+    int64_t exponent = 0;
+    bool dot = false;
+    bool hasDigits = false;
+    const char* it = begin;
+    for (;it != end && *it != 'e' && *it != 'E';++it) {
+        if (*it == '.') {
+            dot = true;
+            continue;
+        }
+        if (*it < '0' || *it > '9') {
+            return std::make_pair(false, 0.0);
+        }
+        hasDigits = true;
+        // Leading zeros are not significant
+        if (mantissa == 0 && *it == '0') {
+            exponent -= dot ? 1 : 0;
+            continue;
+        }
+        if (++digits > MaxMantissaDigits) {
+            return slowParseFloat(begin, end);
+        }
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*it - '0');
+        exponent -= dot ? 1 : 0;
+    }
+
+    // A dot alone (accepted by the float lexic) isn't a number
+    if (!hasDigits) {
+        return std::make_pair(false, 0.0);
+    }
+
+    // Read the exponent
+    if (it != end) {
+        ++it;
+        bool negative = it != end && *it == '-';
+        if (it != end && (*it == '+' || *it == '-')) {
+            ++it;
+        }
+        if (it == end) {
+            return std::make_pair(false, 0.0);
+        }
+        int64_t value = 0;
+        for (;it != end;++it) {
+            if (*it < '0' || *it > '9') {
+                return std::make_pair(false, 0.0);
+            }
+            // Beyond this, the value is 0 or infinite whatever the mantissa
+            if (value < 100000) {
+                value = value * 10 + (*it - '0');
+            }
+        }
+        exponent += negative ? -value : value;
+    }
+
+    if (mantissa == 0) {
+        return std::make_pair(true, 0.0);
+    }
+
+    // Clinger's fast path: both the mantissa and the power of ten are exact, so a single operation rounds correctly
+    if (mantissa <= MaxExactMantissa && exponent >= -22 && exponent <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = (exponent < 0) ? value / ExactPowersOfTen[-exponent] : value * ExactPowersOfTen[exponent];
+        return std::make_pair(true, value);
+    }
+
+    return slowParseFloat(begin, end);
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "ReverseScanner.hpp"
+
+ReverseScanner::ReverseScanner(const NFA& dfa) :
+    mTable(DFATable(dfa).minimized()),
+    mReverseTable(DFATable(dfa.reverse().toDFA()).minimized()),
+    mSyncAnalysis(mTable) {
+}
+
+bool ReverseScanner::isTokenEnd(const std::string& input, size_t position) const {
+    uint32_t state = mReverseTable.startState();
+
+    // Read the characters backwards until the reversed DFA accepts or dies
+    while (position > 0) {
+        position--;
+        state = mReverseTable.next(state, static_cast<unsigned char>(input[position]));
+        if (state == DFATable::DeadState) {
+            return false;
+        }
+        if (mReverseTable.token(state) >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ReverseScanner::findTokenStart(const std::string& input, size_t offset) const {
+    return mSyncAnalysis.findTokenStart(mTable, input, offset);
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "SegmentedInput.hpp"
+
+#include <algorithm>
+
+SegmentedInput::SegmentedInput() : mLength(0) {
+}
+
+SegmentedInput::SegmentedInput(const std::vector<std::string_view>& segments) : mLength(0) {
+    for (const std::string_view& segment : segments) {
+        append(segment);
+    }
+}
+
+void SegmentedInput::append(std::string_view segment) {
+    // Empty segments are dropped so that every offset belongs to a single segment
+    if (segment.empty()) {
+        return;
+    }
+
+    mSegments.push_back(segment);
+    mOffsets.push_back(mLength);
+    mLength += segment.size();
+}
+
+size_t SegmentedInput::findSegment(size_t offset) const {
+    auto it = std::upper_bound(mOffsets.begin(), mOffsets.end(), offset);
+    return std::distance(mOffsets.begin(), it) - 1;
+}
+
+char SegmentedInput::at(size_t offset) const {
+    size_t index = findSegment(offset);
+    return mSegments.at(index).at(offset - mOffsets[index]);
+}
+
+std::string SegmentedInput::substr(size_t offset, size_t length) const {
+    std::string result;
+    length = std::min(length, mLength - std::min(offset, mLength));
+    result.reserve(length);
+
+    size_t index = findSegment(offset);
+    while (length > 0) {
+        std::string_view part = mSegments[index].substr(offset - mOffsets[index], length);
+        result.append(part.data(), part.size());
+        offset += part.size();
+        length -= part.size();
+        index++;
+    }
+    return result;
+}
\ No newline at end of file
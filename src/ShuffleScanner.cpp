@@ -0,0 +1,73 @@
+#include "ShuffleScanner.hpp"
+
+#include <stdexcept>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define LEXER_SHUFFLE_AVAILABLE
+#include <immintrin.h>
+#endif
+
+ShuffleScanner::ShuffleScanner(const DFATable& table) : mTable(table), mMasks{}, mTokens{} {
+    if (table.stateCount() > MaxStates) {
+        throw std::runtime_error("The DFA has too many states to be run with shuffles");
+    }
+
+    // A state is encoded as its index, with flags in the bits ignored by PSHUFB
+    auto encode = [&table](uint32_t state) -> uint8_t {
+        if (state == DFATable::DeadState) {
+            return DeadFlag;
+        }
+        return state | (table.token(state) >= 0 ? AcceptingFlag : 0);
+    };
+
+    for (unsigned int c = 0;c < 256;++c) {
+        for (uint32_t state{0};state < MaxStates;++state) {
+            mMasks[c][state] = (state < table.stateCount()) ? encode(table.next(state, c)) : DeadFlag;
+        }
+    }
+    for (uint32_t state{0};state < table.stateCount();++state) {
+        mTokens[state] = table.token(state);
+    }
+    mStartState = table.startState();
+}
+
+bool ShuffleScanner::isApplicable(const DFATable& table) {
+#ifdef LEXER_SHUFFLE_AVAILABLE
+    return table.stateCount() <= MaxStates && __builtin_cpu_supports("ssse3");
+#else
+    return false;
+#endif
+}
+
+#ifdef LEXER_SHUFFLE_AVAILABLE
+__attribute__((target("ssse3")))
+#endif
+Match ShuffleScanner::match(const char* begin, const char* end) const {
+#ifdef LEXER_SHUFFLE_AVAILABLE
+    const unsigned char* current = reinterpret_cast<const unsigned char*>(begin);
+    const unsigned char* last = reinterpret_cast<const unsigned char*>(end);
+    Match result{0, 0, -1};
+
+    __m128i state = _mm_set1_epi8(static_cast<char>(mStartState));
+    while (current != last) {
+        __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(mMasks[*current].data()));
+        state = _mm_shuffle_epi8(mask, state);
+
+        uint8_t encoded = static_cast<uint8_t>(_mm_cvtsi128_si32(state));
+        if (encoded & DeadFlag) {
+            break;
+        }
+        current++;
+
+        if (encoded & AcceptingFlag) {
+            result.length = current - reinterpret_cast<const unsigned char*>(begin);
+            result.token = mTokens[encoded & 0x0F];
+        }
+    }
+
+    result.scanned = current - reinterpret_cast<const unsigned char*>(begin);
+    return result;
+#else
+    return mTable.match(begin, end);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "SymbolTable.hpp"
+
+#include <stdexcept>
+
+namespace {
+
+constexpr size_t InitialSlotCount = 64;     // The number of slots of a new shard
+constexpr uint64_t FNVOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t FNVPrime = 1099511628211ull;
+
+}
+
+SymbolTable::SymbolTable() : mSymbolCount(0) {
+    for (Shard& shard : mShards) {
+        shard.slots.assign(InitialSlotCount, Slot{0, NoSymbol, std::string_view()});
+        shard.count = 0;
+    }
+    for (std::atomic<Entry*>& chunk : mDirectory) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+SymbolTable::~SymbolTable() {
+    for (std::atomic<Entry*>& chunk : mDirectory) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+uint32_t SymbolTable::intern(std::string_view name, uint64_t hash) {
+    // The high bits choose the shard, the low bits the first slot
+    Shard& shard = mShards[hash >> 60];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    size_t mask = shard.slots.size() - 1;
+    size_t index = hash & mask;
+    while (shard.slots[index].symbol != NoSymbol) {
+        const Slot& slot = shard.slots[index];
+        if (slot.hash == hash && slot.name == name) {
+            return slot.symbol;
+        }
+        index = (index + 1) & mask;
+    }
+
+    // A new symbol gets the next id, and its string is stored in the shard
+    uint32_t symbol = mSymbolCount.fetch_add(1, std::memory_order_acq_rel);
+    shard.names.emplace_back(name);
+    const std::string& storedName = shard.names.back();
+    shard.slots[index] = Slot{hash, symbol, storedName};
+    shard.count++;
+
+    // The string is published in the directory, whose chunk is allocated by the first thread reaching it
+    auto [chunkIndex, entryIndex] = locate(symbol);
+    Entry* chunk = mDirectory[chunkIndex].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        Entry* allocated = new Entry[FirstChunkSize << chunkIndex]();
+        if (mDirectory[chunkIndex].compare_exchange_strong(chunk, allocated, std::memory_order_acq_rel)) {
+            chunk = allocated;
+        } else {
+            delete[] allocated;
+        }
+    }
+    chunk[entryIndex].store(&storedName, std::memory_order_release);
+
+    // The load factor is kept under one half
+    if (shard.count * 2 > shard.slots.size()) {
+        grow(shard);
+    }
+    return symbol;
+}
+
+std::string_view SymbolTable::name(uint32_t symbol) const {
+    if (symbol >= size()) {
+        throw std::out_of_range("Unknown symbol " + std::to_string(symbol));
+    }
+    auto [chunkIndex, entryIndex] = locate(symbol);
+    Entry* chunk = mDirectory[chunkIndex].load(std::memory_order_acquire);
+    const std::string* name = (chunk == nullptr) ? nullptr : chunk[entryIndex].load(std::memory_order_acquire);
+    if (name == nullptr) {
+        throw std::out_of_range("The symbol " + std::to_string(symbol) + " is being interned");
+    }
+    return *name;
+}
+
+uint64_t SymbolTable::hash(std::string_view name) {
+    uint64_t hash = FNVOffsetBasis;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= FNVPrime;
+    }
+    return hash;
+}
+
+std::pair<size_t, size_t> SymbolTable::locate(uint32_t symbol) {
+    // The chunk k holds FirstChunkSize * 2^k entries, from the id FirstChunkSize * (2^k - 1)
+    uint64_t position = static_cast<uint64_t>(symbol) / FirstChunkSize + 1;
+    size_t chunkIndex = 63 - __builtin_clzll(position);
+    size_t firstSymbol = FirstChunkSize * ((size_t(1) << chunkIndex) - 1);
+    return std::make_pair(chunkIndex, symbol - firstSymbol);
+}
+
+void SymbolTable::grow(Shard& shard) {
+    std::vector<Slot> slots(shard.slots.size() * 2, Slot{0, NoSymbol, std::string_view()});
+    size_t mask = slots.size() - 1;
+    for (const Slot& slot : shard.slots) {
+        if (slot.symbol == NoSymbol) {
+            continue;
+        }
+        size_t index = slot.hash & mask;
+        while (slots[index].symbol != NoSymbol) {
+            index = (index + 1) & mask;
+        }
+        slots[index] = slot;
+    }
+    shard.slots = std::move(slots);
+}
\ No newline at end of file
@@ -0,0 +1,301 @@
+#include "SyncAnalysis.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // A run of the lexer between two characters is a state of the DFA, and whether the current token
+    // went through an accepting state before it (never set in an accepting state, where the token can end)
+    constexpr uint32_t ErrorRun = 0xFFFFFFFF;       // The run found an invalid token
+    constexpr uint32_t BacktrackRun = 0xFFFFFFFE;   // The run goes back to the end of its last accepted token
+
+    uint32_t makeRun(const DFATable& table, uint32_t state, bool accepted) {
+        return state * 2 + ((accepted && table.token(state) < 0) ? 1 : 0);
+    }
+
+    uint32_t nextRun(const DFATable& table, uint32_t run, unsigned char character) {
+        uint32_t state = run / 2;
+        bool accepting = table.token(state) >= 0;
+        uint32_t next = table.next(state, character);
+
+        if (next != DFATable::DeadState) {
+            return makeRun(table, next, (run & 1) || accepting);
+        }
+        if (!accepting && state != table.startState()) {
+            return (run & 1) ? BacktrackRun : ErrorRun;
+        }
+
+        // The token ends here: the lexer looks for the next one at this character, or skips it if it is a separator
+        next = table.next(table.startState(), character);
+        if (next != DFATable::DeadState) {
+            return makeRun(table, next, table.token(table.startState()) >= 0);
+        }
+        return (character == ' ' || character == '\n') ? makeRun(table, table.startState(), false) : ErrorRun;
+    }
+}
+
+SyncAnalysis::SyncAnalysis(const DFATable& table) : mHasSyncCharacters(false) {
+    // Find the characters that no state consumes
+    mBoundaries.fill(true);
+    for (uint32_t state{0};state < table.stateCount();++state) {
+        for (unsigned int c = 0;c < 256;++c) {
+            if (table.next(state, c) != DFATable::DeadState) {
+                mBoundaries[c] = false;
+            }
+        }
+    }
+
+    mSyncs.fill(false);
+    for (unsigned char c : {' ', '\n'}) {
+        mSyncs[c] = mBoundaries[c];
+        mHasSyncCharacters = mHasSyncCharacters || mSyncs[c];
+    }
+
+    // Find the states leading to an accepting state
+    std::vector<bool> live(table.stateCount(), false);
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t state{0};state < table.stateCount();++state) {
+            if (live[state]) {
+                continue;
+            }
+            bool reachesAccepting = table.token(state) >= 0;
+            for (unsigned int c = 0;c < 256 && !reachesAccepting;++c) {
+                uint32_t target = table.next(state, c);
+                reachesAccepting = target != DFATable::DeadState && live[target];
+            }
+            if (reachesAccepting) {
+                live[state] = true;
+                changed = true;
+            }
+        }
+    }
+
+    // A token starts with a character leading from the starting state to a state that can still accept
+    for (unsigned int c = 0;c < 256;++c) {
+        uint32_t target = table.next(table.startState(), c);
+        mStarts[c] = target != DFATable::DeadState && live[target];
+    }
+
+    // The scan length is the longest path from the starting state. Restricted to the states leading to
+    // an accepting state, the longest path ends in an accepting state: it is the token length.
+    mMaxScanLength = longestPath(table, std::vector<bool>(table.stateCount(), true));
+    mMaxTokenLength = live[table.startState()] ? longestPath(table, live) : 0;
+
+    mConvergenceLength = runConvergence(table);
+}
+
+size_t SyncAnalysis::longestPath(const DFATable& table, const std::vector<bool>& allowed) {
+    enum class Mark { New, Visiting, Done };
+    std::vector<Mark> marks(table.stateCount(), Mark::New);
+    std::vector<size_t> lengths(table.stateCount(), 0);
+    bool cycle = false;
+
+    std::function<void(uint32_t)> visit = [&](uint32_t state) {
+        marks[state] = Mark::Visiting;
+
+        for (unsigned int c = 0;c < 256 && !cycle;++c) {
+            uint32_t target = table.next(state, c);
+            if (target == DFATable::DeadState || !allowed[target]) {
+                continue;
+            }
+
+            if (marks[target] == Mark::Visiting) {
+                cycle = true;
+                return;
+            }
+            if (marks[target] == Mark::New) {
+                visit(target);
+            }
+            lengths[state] = std::max(lengths[state], lengths[target] + 1);
+        }
+
+        marks[state] = Mark::Done;
+    };
+    visit(table.startState());
+
+    return cycle ? Unbounded : lengths[table.startState()];
+}
+
+size_t SyncAnalysis::runConvergence(const DFATable& table) {
+    // A run in the starting state must be between two tokens
+    for (uint32_t state{0};state < table.stateCount();++state) {
+        for (unsigned int c = 0;c < 256;++c) {
+            if (table.next(state, c) == table.startState()) {
+                return Unbounded;
+            }
+        }
+    }
+
+    // The characters having the same transitions (and being separators or not) lead the runs to the same states
+    std::vector<unsigned char> characters;
+    std::map<std::vector<uint32_t>, unsigned char> columns;
+    for (unsigned int c = 0;c < 256;++c) {
+        std::vector<uint32_t> column(table.stateCount() + 1, (c == ' ' || c == '\n') ? 1 : 0);
+        for (uint32_t state{0};state < table.stateCount();++state) {
+            column[state] = table.next(state, c);
+        }
+        if (columns.emplace(column, c).second) {
+            characters.push_back(c);
+        }
+    }
+
+    // Find the runs of the lexing of an input. They must not backtrack for the lexing to be modelled.
+    uint32_t start = makeRun(table, table.startState(), false);
+    std::vector<uint32_t> runs = {start};
+    std::vector<bool> reached(table.stateCount() * 2, false);
+    reached[start] = true;
+    for (size_t i{0};i < runs.size();++i) {
+        for (unsigned char c : characters) {
+            uint32_t next = nextRun(table, runs[i], c);
+            if (next == BacktrackRun) {
+                return Unbounded;
+            }
+            if (next != ErrorRun && !reached[next]) {
+                reached[next] = true;
+                runs.push_back(next);
+            }
+        }
+    }
+
+    // Follow the pairs of a run started at a position and of the lexing of the input at this position,
+    // until their runs are the same. The longest walk is the bound, a cycle meaning that they can stay
+    // apart forever. A walk where a run finds an invalid token is not followed.
+    enum class Mark { Visiting, Done };
+    struct Pair {
+        Mark mark;
+        size_t length;
+    };
+    struct Frame {
+        uint64_t pair;
+        size_t character;
+    };
+    std::unordered_map<uint64_t, Pair> pairs;
+    std::vector<Frame> stack;
+    size_t convergence{0};
+
+    for (uint32_t run : runs) {
+        uint64_t root = (static_cast<uint64_t>(start) << 32) | run;
+        if (run == start || pairs.count(root)) {
+            continue;
+        }
+        pairs[root] = Pair{Mark::Visiting, 0};
+        stack.push_back(Frame{root, 0});
+
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            Pair& pair = pairs[frame.pair];
+
+            if (frame.character == characters.size()) {
+                pair.mark = Mark::Done;
+                size_t length = pair.length;
+                stack.pop_back();
+                if (!stack.empty()) {
+                    Pair& parent = pairs[stack.back().pair];
+                    parent.length = std::max(parent.length, length + 1);
+                }
+                continue;
+            }
+
+            unsigned char c = characters[frame.character++];
+            uint32_t first = nextRun(table, static_cast<uint32_t>(frame.pair >> 32), c);
+            uint32_t second = nextRun(table, static_cast<uint32_t>(frame.pair), c);
+            if (first == ErrorRun || second == ErrorRun) {
+                continue;
+            }
+            if (first == second) {
+                pair.length = std::max<size_t>(pair.length, 1);
+                continue;
+            }
+
+            uint64_t next = (static_cast<uint64_t>(first) << 32) | second;
+            auto [found, inserted] = pairs.try_emplace(next, Pair{Mark::Visiting, 0});
+            if (inserted) {
+                if (pairs.size() > MaxAnalyzedPairs) {
+                    return Unbounded;
+                }
+                stack.push_back(Frame{next, 0});
+            } else if (found->second.mark == Mark::Visiting) {
+                return Unbounded;
+            } else {
+                pair.length = std::max(pair.length, found->second.length + 1);
+            }
+        }
+        convergence = std::max(convergence, pairs[root].length);
+    }
+
+    return convergence;
+}
+
+size_t SyncAnalysis::nextSyncPoint(const std::string& input, size_t from, size_t to) const {
+    for (size_t i{from};i < to;++i) {
+        if (mSyncs[static_cast<unsigned char>(input[i])]) {
+            return i;
+        }
+    }
+    return std::string::npos;
+}
+
+size_t SyncAnalysis::previousSyncPoint(const std::string& input, size_t position) const {
+    while (position > 0) {
+        position--;
+        if (mSyncs[static_cast<unsigned char>(input[position])]) {
+            return position;
+        }
+    }
+    return 0;
+}
+
+size_t SyncAnalysis::findTokenStart(const DFATable& table, const std::string& input, size_t offset) const {
+    offset = std::min(offset, input.length());
+    const char* data = input.data();
+
+    // The lexing always looks for a token at a sync point
+    size_t syncPoint = offset;
+    if (offset == input.length() || !mSyncs[static_cast<unsigned char>(input[offset])]) {
+        syncPoint = previousSyncPoint(input, offset);
+    }
+
+    // A run started at 'from' looks for tokens at the same positions as the lexing of the whole input
+    // from 'from + mConvergenceLength' on. We start close to the offset and widen the window until the
+    // confirmed part of the run reaches a position before the offset.
+    size_t window = (mConvergenceLength == Unbounded) ? Unbounded : 2 * std::max<size_t>(mConvergenceLength, 1);
+    while (true) {
+        bool speculative = window < offset - syncPoint;
+        size_t from = speculative ? offset - window : syncPoint;
+        size_t confirmed = speculative ? from + mConvergenceLength : from;
+
+        size_t found = std::string::npos;
+        size_t position = from;
+        while (position <= offset) {
+            if (position >= confirmed) {
+                found = position;
+            }
+            if (position == input.length()) {
+                break;
+            }
+
+            Match m = table.match(data + position, data + input.length());
+            if (m.token >= 0) {
+                position += m.length;
+            } else if (m.scanned == 0 && (data[position] == ' ' || data[position] == '\n')) {
+                position++;
+            } else {
+                // The runs are only known to converge when neither finds an invalid token
+                if (position < confirmed) {
+                    found = std::string::npos;
+                }
+                break;
+            }
+        }
+
+        if (found != std::string::npos || !speculative) {
+            return found;
+        }
+        window = (window > (offset - syncPoint) / 2) ? offset - syncPoint : window * 2;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "ThreadedScanner.hpp"
+
+ThreadedScanner::ThreadedScanner(const DFATable& table) :
+    mTable(table),
+    mKinds(table.stateCount()),
+    mChainCharacters(table.stateCount(), 0),
+    mChainTargets(table.stateCount(), DFATable::DeadState) {
+    for (uint32_t state{0};state < table.stateCount();++state) {
+        size_t transitionCount = 0;
+        bool loops = false;
+        for (unsigned int c = 0;c < 256;++c) {
+            uint32_t target = table.next(state, c);
+            if (target == DFATable::DeadState) {
+                continue;
+            }
+
+            transitionCount++;
+            loops = loops || target == state;
+            mChainCharacters[state] = c;
+            mChainTargets[state] = target;
+        }
+
+        // Loops are the most profitable, then single transitions
+        if (loops) {
+            mKinds[state] = static_cast<uint8_t>(Kind::Accelerable);
+        } else if (transitionCount == 1) {
+            mKinds[state] = static_cast<uint8_t>(Kind::Chain);
+        } else if (table.token(state) >= 0) {
+            mKinds[state] = static_cast<uint8_t>(Kind::Accepting);
+        } else {
+            mKinds[state] = static_cast<uint8_t>(Kind::Dense);
+        }
+    }
+}
+
+Match ThreadedScanner::match(const char* begin, const char* end) const {
+#if defined(__GNUC__)
+    // The handlers run when entering a state, after having consumed a character
+    static void* const enterHandlers[] = {&&dense, &&accepting, &&accelerable, &&chain};
+    // The starting state is entered without having consumed a character
+    static void* const startHandlers[] = {&&dense, &&dense, &&accelerableRead, &&chainRead};
+
+    const unsigned char* current = reinterpret_cast<const unsigned char*>(begin);
+    const unsigned char* last = reinterpret_cast<const unsigned char*>(end);
+    const unsigned char* lastAccepted = current;
+    int lastToken = -1;
+    uint32_t state = mTable.startState();
+    uint32_t next;
+
+    goto *startHandlers[mKinds[state]];
+
+accepting:
+    lastAccepted = current;
+    lastToken = mTable.token(state);
+dense:
+    if (current == last) {
+        goto done;
+    }
+    next = mTable.next(state, *current);
+    if (next == DFATable::DeadState) {
+        goto done;
+    }
+    state = next;
+    current++;
+    goto *enterHandlers[mKinds[state]];
+
+accelerable:
+    if (mTable.token(state) >= 0) {
+        lastAccepted = current;
+        lastToken = mTable.token(state);
+    }
+accelerableRead: {
+        // Consume all the characters looping on the state
+        const unsigned char* loopStart = current;
+        while (current != last && mTable.next(state, *current) == state) {
+            current++;
+        }
+        if (current != loopStart && mTable.token(state) >= 0) {
+            lastAccepted = current;
+            lastToken = mTable.token(state);
+        }
+    }
+    if (current == last) {
+        goto done;
+    }
+    next = mTable.next(state, *current);
+    if (next == DFATable::DeadState) {
+        goto done;
+    }
+    state = next;
+    current++;
+    goto *enterHandlers[mKinds[state]];
+
+chain:
+    if (mTable.token(state) >= 0) {
+        lastAccepted = current;
+        lastToken = mTable.token(state);
+    }
+chainRead:
+    if (current == last || *current != mChainCharacters[state]) {
+        goto done;
+    }
+    state = mChainTargets[state];
+    current++;
+    goto *enterHandlers[mKinds[state]];
+
+done:
+    return Match{static_cast<size_t>(lastAccepted - reinterpret_cast<const unsigned char*>(begin)),
+                 static_cast<size_t>(current - reinterpret_cast<const unsigned char*>(begin)),
+                 lastToken};
+#else
+    return mTable.match(begin, end);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#include "TokenActions.hpp"
+
+#include <stdexcept>
+
+#include "Lexer.hpp"
+
+TokenActions::TokenActions(const Lexer& lexer) : mLexer(lexer), mActions(lexer.tokenCount()) {
+}
+
+void TokenActions::on(const std::string& type, Action action) {
+    int id = mLexer.tokenId(type);
+    if (id < 0) {
+        throw std::runtime_error("The lexic has no token type " + type);
+    }
+    mActions[id] = std::move(action);
+}
\ No newline at end of file
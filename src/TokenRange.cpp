@@ -0,0 +1,26 @@
+#include "TokenRange.hpp"
+
+#include <tuple>
+
+#include "Lexer.hpp"
+
+TokenRange::Iterator::Iterator() : mRange(nullptr), mPosition(0), mToken{0, 0, -1} {
+}
+
+TokenRange::Iterator::Iterator(const TokenRange* range) : mRange(range), mPosition(0), mToken{0, 0, -1} {
+    ++*this;
+}
+
+TokenRange::Iterator& TokenRange::Iterator::operator++() {
+    bool found;
+    std::tie(found, mToken) = mRange->mLexer.nextToken(mRange->mInput, mPosition);
+
+    // The end iterator is reached when there are no more tokens
+    if (found) {
+        mPosition = mToken.offset + mToken.length;
+    } else {
+        mRange = nullptr;
+        mPosition = 0;
+    }
+    return *this;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "TrieBuilder.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include <stdexcept>
+
+namespace {
+
+using StatePair = std::pair<size_t, size_t>;
+
+constexpr size_t NoState = std::numeric_limits<size_t>::max();  // The side of a pair without path for the input
+
+/**
+ * Adds the transitions of a state to the targets of a pair, by character.
+ */
+void addTargets(const std::map<std::pair<size_t, CharType>, size_t>& transitions, size_t state, bool first,
+                std::map<CharType, StatePair>& targets) {
+    if (state == NoState) {
+        return;
+    }
+
+    auto it = transitions.lower_bound(std::make_pair(state, std::numeric_limits<CharType>::min()));
+    for (;it != transitions.end() && it->first.first == state;++it) {
+        StatePair& target = targets.emplace(it->first.second, StatePair{NoState, NoState}).first->second;
+        (first ? target.first : target.second) = it->second;
+    }
+}
+
+}
+
+NFA TrieBuilder::build(const std::vector<Literal>& literals) {
+    std::vector<State> states = {State("T0", false, true)};
+    std::map<std::pair<size_t, CharType>, size_t> transitions;
+    std::set<CharType> alphabetSet;
+
+    for (const Literal& literal : literals) {
+        if (literal.text.empty()) {
+            throw std::runtime_error("A literal token can't be empty");
+        }
+
+        // Follow the existing prefix, then create the states of the rest of the literal
+        size_t state = 0;
+        for (CharType c : literal.text) {
+            alphabetSet.insert(c);
+            auto it = transitions.find(std::make_pair(state, c));
+            if (it == transitions.end()) {
+                states.push_back(State("T" + std::to_string(states.size())));
+                it = transitions.insert(std::make_pair(std::make_pair(state, c), states.size() - 1)).first;
+            }
+            state = it->second;
+        }
+
+        // The payload keeps the declaration order, which settles the ties between equal priorities
+        for (const TokenInfo& tokenInfo : states[state].payload) {
+            if (tokenInfo.type == literal.type) {
+                throw std::runtime_error("The literal " + literal.text + " of type " + literal.type + " already exists");
+            }
+        }
+        states[state].isAccepting = true;
+        states[state].payload.push_back(TokenInfo{literal.type, literal.priority});
+    }
+
+    std::string alphabet(alphabetSet.begin(), alphabetSet.end());
+    return NFA(alphabet, states, transitions);
+}
+
+NFA TrieBuilder::merge(const NFA& dfa, const std::vector<Literal>& literals) {
+    if (!dfa.isDeterministic()) {
+        throw std::runtime_error("The NFA must be deterministic");
+    }
+
+    NFA trie = build(literals);
+    std::set<CharType> alphabetSet(dfa.mAlphabet.begin(), dfa.mAlphabet.end());
+    alphabetSet.insert(trie.mAlphabet.begin(), trie.mAlphabet.end());
+
+    // We explore the pairs reachable from the starting states, numbering them in the order they are found
+    size_t dfaStart = std::find_if(dfa.mStates.begin(), dfa.mStates.end(),
+                                   [](const State& state) { return state.isStarting; }) - dfa.mStates.begin();
+    std::vector<StatePair> pairs = {StatePair{dfaStart, 0}};
+    std::map<StatePair, size_t> indices = {{pairs.front(), 0}};
+    std::vector<State> states;
+    std::map<std::pair<size_t, CharType>, size_t> transitions;
+
+    for (size_t i{0};i < pairs.size();++i) {
+        StatePair pair = pairs[i];
+
+        // The payload of the DFA comes first, so it wins the ties with the literals
+        State state("M" + std::to_string(i), false, i == 0);
+        if (pair.first != NoState) {
+            const State& dfaState = dfa.mStates[pair.first];
+            state.isAccepting = dfaState.isAccepting;
+            state.payload = dfaState.payload;
+        }
+        if (pair.second != NoState) {
+            const State& trieState = trie.mStates[pair.second];
+            state.isAccepting = state.isAccepting || trieState.isAccepting;
+            state.payload.insert(state.payload.end(), trieState.payload.begin(), trieState.payload.end());
+        }
+        states.push_back(std::move(state));
+
+        std::map<CharType, StatePair> targets;
+        addTargets(dfa.mCharacterTransitionTable, pair.first, true, targets);
+        addTargets(trie.mCharacterTransitionTable, pair.second, false, targets);
+        for (const auto& [c, target] : targets) {
+            auto it = indices.find(target);
+            if (it == indices.end()) {
+                it = indices.insert(std::make_pair(target, pairs.size())).first;
+                pairs.push_back(target);
+            }
+            transitions.insert(std::make_pair(std::make_pair(i, c), it->second));
+        }
+    }
+
+    std::string alphabet(alphabetSet.begin(), alphabetSet.end());
+    NFA merged(alphabet, states, transitions);
+    merged.mKeywords = dfa.mKeywords;
+    return merged;
+}
\ No newline at end of file
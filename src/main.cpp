@@ -7,6 +7,19 @@
 
 #include "NFAIO.hpp"
 #include "Lexer.hpp"
+#include "StaticLexic.hpp"
+
+static constexpr StaticTokenRule staticRules[] = {
+    {"[a-zA-Z_][a-zA-Z0-9_]*", "IDENTIFIER", 10},
+    {"[0-9]+", "NUM", 10},
+    {"[0-9]*\\.[0-9]*([eE][+-]?[0-9]+)?|[0-9]+[eE][+-]?[0-9]+", "FLOAT", 10},
+    {"\\+", "PLUS", 10}, {"-", "MINUS", 10}, {"\\*", "STAR", 10}, {"/", "DIVISION", 10}, {"%", "MODULO", 10},
+    {"\\(", "OPENING_PARENTHESIS", 10}, {"\\)", "CLOSING_PARENTHESIS", 10},
+    {"{", "OPENING_BRACKET", 10}, {"}", "CLOSING_BRACKET", 10},
+    {"\\[", "OPENING_SQUARE_BRACKET", 10}, {"]", "CLOSING_SQUARE_BRACKET", 10}
+};
+
+static constexpr auto staticDFA = compileLexic<32>(staticRules);
 
 
 int main() {
@@ -35,5 +48,13 @@ int main() {
         std::cout << elt.first << "  " << elt.second << std::endl;
     }
 
+    StaticLexer<staticDFA> staticLexer;
+
+    std::cout << "Extracted tokens (compile-time lexic):" << std::endl;
+
+    for (const auto& elt : staticLexer.extractTokens(input)) {
+        std::cout << elt.first << "  " << elt.second << std::endl;
+    }
+
     return 0;
 }
\ No newline at end of file
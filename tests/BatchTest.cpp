@@ -0,0 +1,47 @@
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(30);
+
+    NFA dfa = loadCombinedLexic().toDFA();
+    Lexer lexer(dfa);
+
+    // More inputs than lanes, with empty ones and very different lengths, so that the lanes are refilled
+    std::vector<std::string> inputs = {"", "", "a", " ", "\n\n", "1 + 2 * (3e-2 * (2 - 4))", "", readResource("main.code")};
+    for (size_t i = 0; i < 5 * Lexer::BatchLanes; i++) {
+        size_t tokenCount = (i % 7 == 0) ? 3000 : i % 5;
+        inputs.push_back((i % 4 == 0) ? std::string() : randomValidInput(random, tokenCount));
+    }
+    inputs.push_back("");
+    CHECK(inputs.size() > 2 * Lexer::BatchLanes);
+
+    // Each input gives the tokens of its own lexing, whatever the engine of the lexer
+    for (Lexer::Engine engine : {Lexer::Engine::Auto, Lexer::Engine::Table}) {
+        Lexer batchLexer(dfa, engine);
+        std::vector<std::vector<std::pair<std::string, std::string>>> tokens = batchLexer.extractTokens(inputs);
+
+        CHECK(tokens.size() == inputs.size());
+        for (size_t i = 0; i < inputs.size() && i < tokens.size(); i++) {
+            CHECK(tokens[i] == lexer.extractTokens(inputs[i]));
+        }
+    }
+
+    // The keywords are reclassified
+    NFA keywords = dfa;
+    keywords.addKeyword({"test", "TEST", "IDENTIFIER"});
+    Lexer keywordLexer(keywords);
+    std::vector<std::vector<std::pair<std::string, std::string>>> tokens = keywordLexer.extractTokens(inputs);
+    for (size_t i = 0; i < inputs.size() && i < tokens.size(); i++) {
+        CHECK(tokens[i] == keywordLexer.extractTokens(inputs[i]));
+    }
+
+    // No inputs, or only empty ones
+    CHECK(lexer.extractTokens(std::vector<std::string>()).empty());
+    std::vector<std::vector<std::pair<std::string, std::string>>> empty =
+        lexer.extractTokens(std::vector<std::string>(Lexer::BatchLanes + 1));
+    CHECK(empty.size() == Lexer::BatchLanes + 1);
+    CHECK(std::all_of(empty.begin(), empty.end(),
+                      [](const std::vector<std::pair<std::string, std::string>>& tokens) { return tokens.empty(); }));
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <cstdio>
+
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(37);
+
+    Lexer lexer(loadCombinedLexic());
+    std::string input = randomValidInput(random, 5000);
+    std::vector<Token> expected = lexer.tokenize(input);
+
+    CheckpointIndex index(1000);
+    CHECK(sameTokens(lexer.tokenize(input, index), expected));
+    CHECK(index.inputLength() == input.length());
+    CHECK(index.tokenCount() == expected.size());
+    CHECK(index.checkpoints().size() > 10);
+
+    // The checkpoints are token starts, at least an interval apart
+    for (size_t i = 1; i < index.checkpoints().size(); i++) {
+        const CheckpointIndex::Checkpoint& checkpoint = index.checkpoints()[i];
+        CHECK(checkpoint.offset >= index.checkpoints()[i - 1].offset + index.interval());
+        CHECK(checkpoint.tokenIndex < expected.size() && expected[checkpoint.tokenIndex].offset == checkpoint.offset);
+    }
+
+    // The index is saved and loaded as is
+    const std::string filename = "CheckpointIndexTest.cbor";
+    CHECK(index.saveToFile(filename));
+    CheckpointIndex loaded = CheckpointIndex::loadFromFilename(filename);
+    std::remove(filename.c_str());
+
+    CHECK(loaded.interval() == index.interval());
+    CHECK(loaded.inputLength() == index.inputLength());
+    CHECK(loaded.tokenCount() == index.tokenCount());
+    CHECK(loaded.checkpoints().size() == index.checkpoints().size());
+    for (size_t i = 0; i < index.checkpoints().size() && i < loaded.checkpoints().size(); i++) {
+        CHECK(loaded.checkpoints()[i].offset == index.checkpoints()[i].offset);
+        CHECK(loaded.checkpoints()[i].tokenIndex == index.checkpoints()[i].tokenIndex);
+    }
+
+    // The ranges lexed from the loaded index are the ones of the whole input
+    std::uniform_int_distribution<size_t> token(0, expected.size());
+    std::uniform_int_distribution<size_t> offset(0, input.length());
+    for (size_t i = 0; i < 100; i++) {
+        size_t first = token(random);
+        size_t last = std::max(first, token(random));
+        CHECK(sameTokens(lexer.tokenizeRange(input, loaded, first, last),
+                         std::vector<Token>(expected.begin() + first, expected.begin() + last)));
+
+        size_t begin = offset(random);
+        size_t end = std::max(begin, offset(random));
+        std::vector<Token> overlapping;
+        for (const Token& t : expected) {
+            if (t.offset < end && t.offset + t.length > begin) {
+                overlapping.push_back(t);
+            }
+        }
+        CHECK(sameTokens(lexer.tokenizeBytes(input, loaded, begin, end), overlapping));
+    }
+
+    // A missing index file is reported
+    bool thrown = false;
+    try {
+        CheckpointIndex::loadFromFilename(resourcePath("missing.cbor"));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "TestUtils.hpp"
+#include "TrieBuilder.hpp"
+
+namespace {
+    using Tokens = std::vector<std::pair<std::string, std::string>>;
+
+    const std::vector<Lexer::Engine> engines = {
+        Lexer::Engine::Table, Lexer::Engine::Threaded,
+        Lexer::Engine::JIT, Lexer::Engine::Shuffle, Lexer::Engine::Auto
+    };
+
+    /**
+     * Extracts the tokens of an input, an error being reported as an empty list and a thrown flag.
+     */
+    std::pair<bool, Tokens> extract(Lexer& lexer, const std::string& input) {
+        try {
+            return {true, lexer.extractTokens(input)};
+        } catch (const LexicalErrorException&) {
+            return {false, {}};
+        }
+    }
+
+    /**
+     * Extracts the tokens of an input with the Traverser engine.
+     * A new lexer is needed for each input as this engine keeps its position between calls (see next).
+     */
+    std::pair<bool, Tokens> traverse(const NFA& dfa, const std::string& input) {
+        Lexer lexer(dfa, Lexer::Engine::Traverser);
+
+        return extract(lexer, input);
+    }
+
+    /**
+     * Checks that every engine gives the tokens of the Traverser (run on the DFA) on the given inputs.
+     * The Traverser needs a DFA, the other engines are also given the NFA, that they determinize.
+     */
+    void checkEngines(const NFA& nfa, const std::vector<std::string>& inputs) {
+        NFA dfa = nfa.isDeterministic() ? nfa : nfa.toDFA();
+        std::vector<Lexer> lexers;
+
+        for (Lexer::Engine engine : engines) {
+            lexers.emplace_back(dfa, engine);
+            lexers.emplace_back(nfa, engine);
+        }
+
+        for (const std::string& input : inputs) {
+            std::pair<bool, Tokens> expected = traverse(dfa, input);
+
+            for (Lexer& lexer : lexers) {
+                CHECK(extract(lexer, input) == expected);
+            }
+        }
+    }
+}
+
+int main() {
+    std::mt19937 random(27);
+
+    NFA combined = loadCombinedLexic();
+    NFA dfa = combined.toDFA();
+    NFA lexic = NFAIO::loadFromFilename(resourcePath("lexic.json"));
+
+    std::vector<std::string> inputs = {"", " ", "1 + 2 * (3e-2 * (2 - 4))", readResource("main.code")};
+
+    for (size_t i = 0; i < 200; i++) {
+        inputs.push_back(randomValidInput(random, 1 + i % 30));
+        inputs.push_back(randomInput(random, 1 + i % 40));
+    }
+
+    // The engines agree on the lexics of the resources, whether they are given as DFAs or NFAs
+    CHECK(dfa.isDeterministic());
+    CHECK(!combined.isDeterministic());
+    CHECK(!lexic.isDeterministic());
+
+    checkEngines(combined, inputs);
+    checkEngines(lexic, inputs);
+
+    // The tokens of the resources
+    Lexer lexer(dfa);
+    Tokens expected = {{"1", "NUM"}, {"+", "PLUS"}, {"2", "NUM"}, {"*", "STAR"}, {"(", "OPENING_PARENTHESIS"},
+                       {"3e-2", "FLOAT"}, {"*", "STAR"}, {"(", "OPENING_PARENTHESIS"}, {"2", "NUM"}, {"-", "MINUS"},
+                       {"4", "NUM"}, {")", "CLOSING_PARENTHESIS"}, {")", "CLOSING_PARENTHESIS"}};
+    CHECK(lexer.extractTokens(std::string("1 + 2 * (3e-2 * (2 - 4))")) == expected);
+
+    // The tokens of priority 0 are kept by every engine
+    NFA trie = TrieBuilder::build({{"i", "I", 0}, {"if", "IF", 0}});
+    checkEngines(trie, {"i if", "ifi", "iff i"});
+    CHECK(traverse(trie, "i if") == std::make_pair(true, Tokens{{"i", "I"}, {"if", "IF"}}));
+
+    // A moved lexer keeps working
+    Lexer moved(std::move(lexer));
+    CHECK(moved.extractTokens(std::string("1 + 2 * (3e-2 * (2 - 4))")) == expected);
+
+    // The engine actually used is reported
+    CHECK(Lexer(dfa, Lexer::Engine::Auto).engine() != Lexer::Engine::Auto);
+
+    return testResult();
+}
\ No newline at end of file
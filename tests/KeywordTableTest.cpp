@@ -0,0 +1,118 @@
+#include <cstdio>
+#include <map>
+#include <stdexcept>
+
+#include "TestUtils.hpp"
+
+namespace {
+    using Tokens = std::vector<std::pair<std::string, std::string>>;
+
+    const std::vector<Lexer::Engine> engines = {
+        Lexer::Engine::Table, Lexer::Engine::Threaded,
+        Lexer::Engine::JIT, Lexer::Engine::Shuffle, Lexer::Engine::Auto
+    };
+
+    /**
+     * Reclassifies the tokens of a lexic without keywords, as the keyword table should.
+     */
+    Tokens reclassify(Tokens tokens, const std::vector<KeywordInfo>& keywords) {
+        for (std::pair<std::string, std::string>& token : tokens) {
+            for (const KeywordInfo& keyword : keywords) {
+                if (token.first == keyword.text && token.second == keyword.baseType) {
+                    token.second = keyword.type;
+                }
+            }
+        }
+        return tokens;
+    }
+}
+
+int main() {
+    std::mt19937 random(49);
+
+    NFA dfa = loadCombinedLexic().toDFA();
+    std::vector<KeywordInfo> keywords = {
+        {"if", "IF", "IDENTIFIER"}, {"while", "WHILE", "IDENTIFIER"}, {"test", "TEST", "IDENTIFIER"},
+        {"_", "UNDERSCORE", "IDENTIFIER"}, {"42", "ANSWER", "NUM"}, {"0.5", "HALF", "FLOAT"}
+    };
+    // Enough keywords for several buckets of the perfect hash
+    for (size_t i = 0; i < 300; i++) {
+        keywords.push_back({"kw" + std::to_string(i), "KW" + std::to_string(i % 7), "IDENTIFIER"});
+    }
+
+    NFA withKeywords = dfa;
+    for (const KeywordInfo& keyword : keywords) {
+        withKeywords.addKeyword(keyword);
+    }
+
+    // A keyword is declared once per base type
+    bool thrown = false;
+    try {
+        withKeywords.addKeyword({"if", "OTHER", "IDENTIFIER"});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // The inputs mix keywords, their prefixes and extensions, other lexemes of the base types and keywords
+    // of another base type
+    std::vector<std::string> inputs = {
+        "", "if", "if iff i whil while whilee If IF", "test tests tes _ __ _1", "42 420 4 42.0 0.5 0.50 .5",
+        "kw0 kw299 kw300 kw kw01 kw2x", "if(42)*while[kw7]", readResource("main.code")
+    };
+    static const std::vector<std::string> words = {
+        "if", "iff", "i", "while", "whil", "test", "testing", "_", "x_1", "42", "421", "0.5", "3e-2",
+        "kw0", "kw17", "kw299", "kw300", "kw", "+", "(", ")"
+    };
+    for (size_t i = 0; i < 100; i++) {
+        std::string input;
+        for (size_t j = 0; j < 1 + i % 30; j++) {
+            input += words[std::uniform_int_distribution<size_t>(0, words.size() - 1)(random)] + " ";
+        }
+        inputs.push_back(input);
+        inputs.push_back(randomValidInput(random, 1 + i % 30));
+    }
+
+    // Every engine reclassifies the keywords, and only them
+    std::vector<Lexer> lexers;
+    for (Lexer::Engine engine : engines) {
+        lexers.emplace_back(withKeywords, engine);
+    }
+    Lexer plain(dfa);
+    for (const std::string& input : inputs) {
+        Tokens expected = reclassify(plain.extractTokens(input), keywords);
+
+        for (Lexer& lexer : lexers) {
+            CHECK(lexer.extractTokens(input) == expected);
+        }
+        CHECK(Lexer(withKeywords, Lexer::Engine::Traverser).extractTokens(input) == expected);
+    }
+    Tokens sample = {{"if", "IF"}, {"iff", "IDENTIFIER"}, {"42", "ANSWER"}, {"420", "NUM"}, {"kw8", "KW1"}};
+    CHECK(lexers.front().extractTokens(std::string("if iff 42 420 kw8")) == sample);
+
+    // The parallel lexing reclassifies them as well
+    std::string input = randomValidInput(random, 20000) + "if while kw5 42";
+    CHECK(sameTokens(lexers.front().tokenize(input, 4), lexers.front().tokenize(input)));
+
+    // The keywords are saved with the lexic, and kept by the combination
+    const std::string filename = "KeywordTableTest.json";
+    CHECK(NFAIO::saveToFile(withKeywords, filename));
+    NFA loaded = NFAIO::loadFromFilename(filename);
+    std::remove(filename.c_str());
+    CHECK(loaded.keywords().size() == keywords.size());
+    CHECK(Lexer(loaded).extractTokens(inputs[2]) == lexers.front().extractTokens(inputs[2]));
+    CHECK(NFA::combine({loaded}).keywords().size() == keywords.size());
+
+    // A keyword whose base type isn't in the lexic is rejected
+    NFA unknownBase = dfa;
+    unknownBase.addKeyword({"if", "IF", "KEYWORD"});
+    thrown = false;
+    try {
+        Lexer lexer(unknownBase);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <functional>
+
+#include "TestUtils.hpp"
+#include "StaticLexic.hpp"
+
+namespace {
+    const std::string input = "ab 12\n  + #x";     // The unknown token is at line 2, column 5
+    const size_t errorOffset = 10;
+
+    static constexpr StaticTokenRule staticRules[] = {
+        {"[a-zA-Z_][a-zA-Z0-9_]*", "IDENTIFIER", 10}, {"[0-9]+", "NUM", 10}, {"\\+", "PLUS", 10}
+    };
+    static constexpr auto staticDFA = compileLexic<16>(staticRules);
+
+    /**
+     * Checks that a lexing function throws the error of the unknown token of the input.
+     */
+    void checkError(const std::string& name, const std::function<void()>& lex) {
+        try {
+            lex();
+            std::cerr << name << ": no error" << std::endl;
+            testFailures++;
+        } catch (const LexicalErrorException& error) {
+            LineIndex::Position position = error.position(input);
+            if (error.offset() != errorOffset || position.line != 2 || position.column != 5) {
+                std::cerr << name << ": error at " << error.offset() << " (line " << position.line << ", column "
+                          << position.column << ")" << std::endl;
+                testFailures++;
+            }
+        }
+    }
+
+#if defined(__cpp_impl_coroutine)
+    /**
+     * A coroutine consuming the tokens of an AsyncTokenGenerator, keeping the error it throws.
+     */
+    struct Consumer {
+        struct promise_type {
+            Consumer get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    Consumer consume(AsyncTokenGenerator& generator, std::exception_ptr& error) {
+        try {
+            while (auto token = co_await generator.next()) {
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+#endif
+}
+
+int main() {
+    NFA dfa = loadCombinedLexic().toDFA();
+
+    // Every lexing path reports the offset of the unknown token
+    for (Lexer::Engine engine : {Lexer::Engine::Traverser, Lexer::Engine::Table, Lexer::Engine::Threaded,
+                                 Lexer::Engine::JIT, Lexer::Engine::Shuffle}) {
+        checkError("extractTokens", [&] { Lexer(dfa, engine).extractTokens(input); });
+        checkError("next", [&] {
+            Lexer lexer(dfa, engine);
+            while (lexer.next(input).first) {
+            }
+        });
+    }
+
+    Lexer lexer(dfa);
+    checkError("tokenize", [&] { lexer.tokenize(input); });
+    checkError("batch", [&] { lexer.extractTokens(std::vector<std::string>{"a b", input, "1"}); });
+    checkError("parallel", [&] { lexer.tokenize(input, 4); });
+    checkError("speculative", [&] { lexer.tokenizeSpeculative(input, 4); });
+    checkError("segmented", [&] { lexer.tokenize(SegmentedInput({"ab 1", "2\n  + ", "#x"})); });
+    checkError("lex", [&] { lexer.lex(input, [](int, const char*, const char*) {}); });
+    checkError("tokens", [&] {
+        for (const Token& token : lexer.tokens(input)) {
+            (void) token;
+        }
+    });
+    checkError("static", [&] { StaticLexer<staticDFA>().extractTokens(input); });
+
+#if defined(__cpp_impl_coroutine)
+    checkError("lexAsync", [&] {
+        InputChannel channel;
+        AsyncTokenGenerator generator = lexer.lexAsync(channel);
+        std::exception_ptr error;
+        consume(generator, error);
+        channel.push(input.substr(0, 7));
+        channel.push(input.substr(7));
+        channel.close();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    });
+#endif
+
+    // The position of an error without offset is unknown
+    LineIndex::Position position = LexicalErrorException("error").position(input);
+    CHECK(position.line == 0 && position.column == 0);
+
+    return testResult();
+}
\ No newline at end of file
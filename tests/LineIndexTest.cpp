@@ -0,0 +1,72 @@
+#include "TestUtils.hpp"
+#include "LineIndex.hpp"
+
+namespace {
+    /**
+     * Computes the position of an offset by counting the newlines one character at a time.
+     */
+    LineIndex::Position scalarPosition(const std::string& text, size_t offset) {
+        LineIndex::Position position{1, 1};
+        for (size_t i = 0; i < offset; i++) {
+            if (text[i] == '\n') {
+                position.line++;
+                position.column = 1;
+            } else {
+                position.column++;
+            }
+        }
+        return position;
+    }
+
+    /**
+     * Checks the position of every offset of a text, and the offsets of its lines.
+     */
+    void checkText(const LineIndex& index, const std::string& text) {
+        size_t lineCount = 1 + std::count(text.begin(), text.end(), '\n');
+        CHECK(index.lineCount() == lineCount);
+
+        for (size_t offset = 0; offset <= text.length(); offset++) {
+            LineIndex::Position expected = scalarPosition(text, offset);
+            LineIndex::Position position = index.position(offset);
+            CHECK(position.line == expected.line && position.column == expected.column);
+            if (expected.column == 1) {
+                CHECK(index.lineOffset(expected.line) == offset);
+            }
+        }
+    }
+}
+
+int main() {
+    std::mt19937 random(38);
+
+    // Newlines at the edges of the 16 bytes blocks, in texts longer than two blocks
+    std::string text(48, 'a');
+    for (size_t offset : {0, 15, 16, 31, 32, 47}) {
+        text[offset] = '\n';
+    }
+    checkText(LineIndex(text), text);
+    CHECK(LineIndex(text).lineOffset(3) == 16);
+    CHECK(LineIndex(text).position(31).line == 4 && LineIndex(text).position(31).column == 15);
+
+    // A text without newline, a text of newlines and an empty text
+    checkText(LineIndex(std::string(100, 'x')), std::string(100, 'x'));
+    checkText(LineIndex(std::string(40, '\n')), std::string(40, '\n'));
+    checkText(LineIndex(), "");
+
+    // Random texts, indexed at once or in parts of any size
+    std::uniform_int_distribution<size_t> partLength(0, 40);
+    for (size_t i = 0; i < 50; i++) {
+        text = randomInput(random, 1 + i * 13, "ab \n\n");
+        checkText(LineIndex(text), text);
+
+        LineIndex index;
+        for (size_t position = 0; position < text.length();) {
+            size_t length = std::min(partLength(random), text.length() - position);
+            index.append(std::string_view(text).substr(position, length));
+            position += length;
+        }
+        checkText(index, text);
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "TestUtils.hpp"
+#include "NumberParser.hpp"
+
+namespace {
+    std::pair<bool, uint64_t> integer(const char* text) {
+        return NumberParser::parseInteger(text, text + std::strlen(text));
+    }
+
+    std::pair<bool, double> real(const char* text) {
+        return NumberParser::parseFloat(text, text + std::strlen(text));
+    }
+
+    /**
+     * Checks that a float is converted as strtod does.
+     */
+    bool sameAsStrtod(const char* text) {
+        std::pair<bool, double> value = real(text);
+        return value.first && value.second == std::strtod(text, nullptr);
+    }
+}
+
+int main() {
+    std::mt19937_64 random(47);
+
+    // Integers
+    CHECK(integer("0") == std::make_pair(true, uint64_t(0)));
+    CHECK(integer("007") == std::make_pair(true, uint64_t(7)));
+    CHECK(integer("18446744073709551615") == std::make_pair(true, UINT64_MAX));
+    CHECK(!integer("18446744073709551616").first);
+    CHECK(!integer("99999999999999999999").first);
+    CHECK(!integer("").first);
+    CHECK(!integer("12a").first);
+
+    // The float forms of the lexic
+    CHECK(real("1.5") == std::make_pair(true, 1.5));
+    CHECK(real(".5") == std::make_pair(true, 0.5));
+    CHECK(real("1.") == std::make_pair(true, 1.0));
+    CHECK(real("3e-2") == std::make_pair(true, 0.03));
+    CHECK(real("1.25E+10") == std::make_pair(true, 1.25e10));
+    CHECK(real("0.0") == std::make_pair(true, 0.0));
+    CHECK(real("0e999999") == std::make_pair(true, 0.0));
+
+    // Lexemes without digits or with an incomplete exponent aren't numbers
+    CHECK(!real(".").first);
+    CHECK(!real("1e").first);
+    CHECK(!real("1e+").first);
+    CHECK(!real("1.5x").first);
+
+    // Out of range values
+    CHECK(!real("1e400").first);
+    CHECK(!real("1e99999999999").first);
+
+    // The values out of the fast path are rounded as strtod does
+    CHECK(sameAsStrtod("9007199254740993"));                // 2^53 + 1
+    CHECK(sameAsStrtod("12345678901234567890.5"));          // More digits than fit in 64 bits
+    CHECK(sameAsStrtod("0.000000000000000000000000001"));   // Beyond the exact powers of ten
+    CHECK(sameAsStrtod("2.2250738585072014e-308"));         // The smallest normal double
+    CHECK(sameAsStrtod("1.7976931348623157e308"));          // The largest double
+    CHECK(sameAsStrtod("0.1"));
+    CHECK(sameAsStrtod("123456789012345678e-5"));
+
+    // Random doubles, printed with enough digits to be read back exactly
+    for (size_t i = 0; i < 100000; i++) {
+        double value;
+        do {
+            uint64_t bits = random();
+            std::memcpy(&value, &bits, sizeof(value));
+        } while (!std::isfinite(value) || value <= 0.0 || !std::isnormal(value));
+
+        char text[64];
+        std::snprintf(text, sizeof(text), (i % 2) ? "%.17g" : "%.15g", value);
+        CHECK(sameAsStrtod(text));
+    }
+
+    // The numbers are converted while lexing
+    Lexer lexer(loadCombinedLexic());
+    std::vector<NumericToken> tokens = lexer.tokenizeNumbers("12 + .5 * x");
+    CHECK(tokens.size() == 5);
+    if (tokens.size() == 5) {
+        CHECK(tokens[0].kind == NumericToken::Kind::Integer && tokens[0].integer == 12);
+        CHECK(tokens[1].kind == NumericToken::Kind::None);
+        CHECK(tokens[2].kind == NumericToken::Kind::Float && tokens[2].real == 0.5);
+        CHECK(tokens[4].kind == NumericToken::Kind::None);
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(31);
+
+    NFA dfa = loadCombinedLexic().toDFA();
+    Lexer lexer(dfa);
+
+    // The separators of the resources lexics are sync characters, the input is split at them
+    CHECK(lexer.syncAnalysis().hasSyncCharacters());
+
+    // Large enough to be split in several chunks
+    std::string input = randomValidInput(random, 200000);
+    std::vector<Token> expected = lexer.tokenize(input);
+
+    for (size_t threadCount : {1, 2, 3, 4, 7, 0}) {
+        CHECK(sameTokens(lexer.tokenize(input, threadCount), expected));
+    }
+
+    // The string tokens are the same as the sequential ones
+    Lexer tableLexer(dfa, Lexer::Engine::Table);
+    CHECK(tableLexer.extractTokens(input, 4) == tableLexer.extractTokens(input));
+
+    // Small inputs are lexed by one thread
+    std::string small = randomValidInput(random, 20);
+    CHECK(sameTokens(lexer.tokenize(small, 4), lexer.tokenize(small)));
+    CHECK(lexer.tokenize(std::string(), 4).empty());
+
+    // An invalid token is reported whatever the chunk it is in
+    for (size_t offset : {size_t(10), input.length() / 2, input.length() - 2}) {
+        std::string invalid = input;
+        invalid[offset] = '#';
+        bool thrown = false;
+        try {
+            lexer.tokenize(invalid, 4);
+        } catch (const LexicalErrorException&) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "TestUtils.hpp"
+
+namespace {
+    using Tokens = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * Extracts the tokens of an input with the recovery, as lexemes and types, counting the reported errors.
+     */
+    Tokens recover(const Lexer& lexer, const std::string& input, size_t& errorCount) {
+        Tokens tokens;
+        errorCount = 0;
+        for (const Token& token : lexer.tokenizeWithRecovery(input, [&errorCount](const Token&) { errorCount++; })) {
+            tokens.emplace_back(input.substr(token.offset, token.length), lexer.tokenType(token.type));
+        }
+        return tokens;
+    }
+}
+
+int main() {
+    std::mt19937 random(39);
+
+    Lexer lexer(loadCombinedLexic());
+    size_t errorCount;
+
+    // The error tokens cover exactly the invalid characters
+    Tokens expected = {{"ab", "IDENTIFIER"}, {"#$", "ERROR"}, {"12", "NUM"}};
+    CHECK(recover(lexer, "ab #$ 12", errorCount) == expected);
+    CHECK(errorCount == 1);
+
+    // The lexing resumes at the next character that can start a token, even without separator
+    expected = {{"ab", "IDENTIFIER"}, {"#$", "ERROR"}, {"12", "NUM"}, {"@", "ERROR"}, {"x", "IDENTIFIER"},
+                {"#", "ERROR"}, {"+", "PLUS"}};
+    CHECK(recover(lexer, "ab#$12@x#+", errorCount) == expected);
+    CHECK(errorCount == 3);
+
+    // Errors at the edges of the input
+    expected = {{"#", "ERROR"}, {"a", "IDENTIFIER"}, {"!", "ERROR"}};
+    CHECK(recover(lexer, "#a !", errorCount) == expected);
+    CHECK(errorCount == 2);
+    std::vector<Token> tokens = lexer.tokenizeWithRecovery("#a ! ?");
+    CHECK(tokens.size() == 4 && tokens.front().type == Lexer::ErrorToken && tokens.back().offset == 5);
+
+    // The error tokens are the ones passed to the callback
+    std::vector<Token> errors;
+    tokens = lexer.tokenizeWithRecovery("a $ b %% c ~~~", [&errors](const Token& token) { errors.push_back(token); });
+    std::vector<Token> errorTokens;
+    std::copy_if(tokens.begin(), tokens.end(), std::back_inserter(errorTokens),
+                 [](const Token& token) { return token.type == Lexer::ErrorToken; });
+    CHECK(errors.size() == 2 && sameTokens(errors, errorTokens));
+
+    // On valid inputs, the tokens are the ones of tokenize, without errors
+    for (size_t i = 0; i < 100; i++) {
+        std::string input = randomValidInput(random, 1 + i % 50);
+        bool thrown = false;
+        try {
+            errors.clear();
+            tokens = lexer.tokenizeWithRecovery(input, [&errors](const Token& token) { errors.push_back(token); });
+        } catch (const std::exception&) {
+            thrown = true;
+        }
+        CHECK(!thrown && errors.empty());
+        CHECK(sameTokens(tokens, lexer.tokenize(input)));
+    }
+
+    return testResult();
+}
\ No newline at end of file
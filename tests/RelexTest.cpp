@@ -0,0 +1,57 @@
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(35);
+
+    // The second lexic has no operators but "+" and "-"
+    std::vector<std::pair<NFA, std::string>> lexics = {
+        {loadCombinedLexic(), "abzXY_0189.eE+-*/%(){}[]    \n"},
+        {NFAIO::loadFromFilename(resourcePath("lexic.json")), "ifab_019.eE+-    \n"}
+    };
+
+    for (const auto& [nfa, characters] : lexics) {
+        Lexer lexer(nfa);
+        size_t checked = 0;
+
+        for (size_t i = 0; i < 2000; i++) {
+            std::string input = randomInput(random, 1 + i % 80, characters);
+            std::vector<Token> tokens;
+            try {
+                tokens = lexer.tokenize(input);
+            } catch (const LexicalErrorException&) {
+                continue;
+            }
+
+            // Replace a random part of the input by random characters
+            std::uniform_int_distribution<size_t> position(0, input.length());
+            size_t offset = position(random);
+            size_t removed = std::uniform_int_distribution<size_t>(0, std::min<size_t>(input.length() - offset, 5))(random);
+            std::string inserted = randomInput(random, std::uniform_int_distribution<size_t>(0, 5)(random), characters);
+            std::string edited = input.substr(0, offset) + inserted + input.substr(offset + removed);
+
+            std::vector<Token> expected;
+            try {
+                expected = lexer.tokenize(edited);
+            } catch (const LexicalErrorException&) {
+                // The relexing of an invalid input throws as well
+                bool thrown = false;
+                try {
+                    lexer.relex(tokens, edited, TextEdit{offset, removed, inserted.length()});
+                } catch (const LexicalErrorException&) {
+                    thrown = true;
+                }
+                CHECK(thrown);
+                continue;
+            }
+
+            // The updated tokens are the tokens of the edited input
+            lexer.relex(tokens, edited, TextEdit{offset, removed, inserted.length()});
+            CHECK(sameTokens(tokens, expected));
+            checked++;
+        }
+
+        CHECK(checked > 100);
+    }
+
+    return testResult();
+}
\ No newline at end of file
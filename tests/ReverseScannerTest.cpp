@@ -0,0 +1,105 @@
+#include "TestUtils.hpp"
+#include "ReverseScanner.hpp"
+#include "TrieBuilder.hpp"
+
+namespace {
+    /**
+     * Finds the last position, at or before an offset, where the lexing of the whole input looks for a token:
+     * a token start, or a position between two tokens.
+     */
+    size_t lastAttempt(const std::vector<Token>& tokens, size_t inputLength, size_t offset) {
+        size_t attempt = 0;
+        size_t position = 0;
+        for (const Token& token : tokens) {
+            if (token.offset > offset) {
+                return offset;
+            }
+            attempt = token.offset;
+            position = token.offset + token.length;
+            if (position > offset) {
+                return attempt;
+            }
+        }
+        return (position <= offset) ? std::min(offset, inputLength) : attempt;
+    }
+
+    /**
+     * Checks the restart points of every offset of an input, and the tokens lexed from them.
+     */
+    void checkInput(const NFA& dfa, const std::string& input) {
+        ReverseScanner scanner(dfa);
+        Lexer lexer(dfa);
+        std::vector<Token> expected;
+        try {
+            expected = lexer.tokenize(input);
+        } catch (const LexicalErrorException&) {
+            return;
+        }
+
+        for (size_t offset = 0; offset <= input.length(); offset++) {
+            size_t start = scanner.findTokenStart(input, offset);
+            CHECK(start == lastAttempt(expected, input.length(), offset));
+
+            // Lexing from the restart point gives the tokens of the whole input from there
+            std::vector<Token> tokens = lexer.tokenize(input.substr(start));
+            auto first = std::lower_bound(expected.begin(), expected.end(), start,
+                                          [](const Token& token, size_t position) { return token.offset < position; });
+            CHECK(tokens.size() == static_cast<size_t>(expected.end() - first));
+            for (size_t i = 0; i < tokens.size() && first + i < expected.end(); i++) {
+                CHECK(tokens[i].offset + start == first[i].offset);
+                CHECK(tokens[i].length == first[i].length && tokens[i].type == first[i].type);
+            }
+
+            // The tokens of a byte range are the ones of the whole input overlapping it
+            size_t end = std::min(input.length(), offset + 7);
+            std::vector<Token> overlapping;
+            for (const Token& token : expected) {
+                if (token.offset + token.length > offset && token.offset < end) {
+                    overlapping.push_back(token);
+                }
+            }
+            CHECK(sameTokens(lexer.tokenizeBytes(input, offset, end), overlapping));
+        }
+    }
+}
+
+int main() {
+    std::mt19937 random(34);
+
+    // A position inside an identifier isn't a restart point, even if a token could end there
+    NFA dfa = loadCombinedLexic().toDFA();
+    ReverseScanner scanner(dfa);
+    std::string input = "abcdef + 12345";
+    CHECK(scanner.isTokenEnd(input, 3));
+    CHECK(scanner.findTokenStart(input, 3) == 0);
+    CHECK(scanner.findTokenStart(input, 5) == 0);
+    CHECK(scanner.findTokenStart(input, 7) == 7);
+    CHECK(scanner.findTokenStart(input, 11) == 9);
+    CHECK(scanner.findTokenStart(input, 100) == input.length());
+    checkInput(dfa, input);
+
+    // The lexic with sync characters, on inputs with and without separators
+    for (size_t i = 0; i < 30; i++) {
+        checkInput(dfa, randomValidInput(random, 1 + i % 20));
+        checkInput(dfa, randomInput(random, 1 + i % 40, "abzX_0189+-*/%()"));
+    }
+
+    // Without separators in the input, the positions are confirmed by the convergence of the runs
+    NFA identifiers = NFA::combine({
+        NFAIO::loadFromFilename(resourcePath("identifier_lexic.json")),
+        NFAIO::loadFromFilename(resourcePath("operator_lexic.json"))
+    }).toDFA();
+    NFA trie = TrieBuilder::build({{"a", "A", 1}, {"ab", "AB", 1}, {"b", "B", 1}, {" ", "SPACE", 1}});
+    for (size_t i = 0; i < 30; i++) {
+        checkInput(identifiers, randomInput(random, 1 + i * 3, "abz_019+-*/()"));
+        checkInput(trie, randomInput(random, 1 + i * 3, "ab "));
+    }
+
+    // A lexic whose runs don't converge is lexed from the beginning
+    NFA backtracking = TrieBuilder::build({{"ab", "AB", 1}, {"abcd", "ABCD", 1}, {"c", "C", 1}});
+    for (size_t i = 0; i < 30; i++) {
+        checkInput(backtracking, randomInput(random, 1 + i * 3, "abcd"));
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "TestUtils.hpp"
+
+namespace {
+    /**
+     * Cuts a text in segments of random lengths, empty ones included.
+     */
+    std::vector<std::string_view> randomSegments(std::mt19937& random, std::string_view text, size_t maxLength) {
+        std::uniform_int_distribution<size_t> segmentLength(0, maxLength);
+        std::vector<std::string_view> segments = {text.substr(0, 0)};
+        for (size_t position = 0; position < text.length();) {
+            size_t length = std::min(segmentLength(random), text.length() - position);
+            segments.push_back(text.substr(position, length));
+            position += length;
+        }
+        segments.push_back(text.substr(text.length()));
+        return segments;
+    }
+}
+
+int main() {
+    std::mt19937 random(36);
+
+    NFA dfa = loadCombinedLexic().toDFA();
+    dfa.addKeyword({"test", "TEST", "IDENTIFIER"});
+    dfa.addKeyword({"bite", "BITE", "IDENTIFIER"});
+
+    // Tokens and keywords straddling the segment edges, with empty segments between them
+    Lexer lexer(dfa);
+    std::string text = "test + 1234.5e+10 bite";
+    SegmentedInput input({"te", "", "st + 12", "34", ".", "", "5e", "+1", "0 bi", "te", ""});
+    CHECK(input.length() == text.length());
+    std::vector<Token> tokens = lexer.tokenize(input);
+    CHECK(sameTokens(tokens, lexer.tokenize(text)));
+    CHECK(tokens.size() == 4 && lexer.tokenType(tokens[0].type) == "TEST" && lexer.tokenType(tokens[3].type) == "BITE");
+    CHECK(input.substr(tokens[2].offset, tokens[2].length) == "1234.5e+10");
+
+    // Random cuts, down to one character per segment, for several engines
+    for (Lexer::Engine engine : {Lexer::Engine::Auto, Lexer::Engine::Table, Lexer::Engine::Threaded}) {
+        Lexer engineLexer(dfa, engine);
+        for (size_t i = 0; i < 100; i++) {
+            text = randomValidInput(random, 1 + i % 40);
+            std::vector<std::string_view> segments = randomSegments(random, text, 1 + i % 12);
+
+            SegmentedInput segmented;
+            for (std::string_view segment : segments) {
+                segmented.append(segment);
+            }
+            CHECK(segmented.length() == text.length());
+            CHECK(sameTokens(engineLexer.tokenize(segmented), engineLexer.tokenize(text)));
+            CHECK(sameTokens(engineLexer.tokenize(SegmentedInput(segments)), engineLexer.tokenize(text)));
+        }
+    }
+
+    // An input made of empty segments has no tokens
+    CHECK(lexer.tokenize(SegmentedInput({"", "", ""})).empty());
+    CHECK(lexer.tokenize(SegmentedInput()).empty());
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "TestUtils.hpp"
+
+namespace {
+    /**
+     * Lexes an input, an error being reported as an empty list and a thrown flag.
+     */
+    template <typename Tokenize>
+    std::pair<bool, std::vector<Token>> lex(Tokenize tokenize) {
+        try {
+            return {true, tokenize()};
+        } catch (const LexicalErrorException&) {
+            return {false, {}};
+        }
+    }
+
+    /**
+     * Compares two results of lex.
+     */
+    bool sameResult(const std::pair<bool, std::vector<Token>>& a, const std::pair<bool, std::vector<Token>>& b) {
+        return a.first == b.first && sameTokens(a.second, b.second);
+    }
+}
+
+int main() {
+    std::mt19937 random(32);
+
+    // The second lexic has no parentheses, so some of the inputs are invalid for it
+    for (const NFA& nfa : {loadCombinedLexic(), NFAIO::loadFromFilename(resourcePath("lexic.json"))}) {
+        Lexer lexer(nfa);
+
+        // Inputs of the tokens of the resources, the chunk boundaries falling inside tokens and separators
+        for (size_t i = 0; i < 100; i++) {
+            std::string input = randomValidInput(random, 1 + i * 10);
+            auto expected = lex([&] { return lexer.tokenize(input); });
+
+            for (size_t threadCount : {1, 2, 3, 5, 16, 0}) {
+                CHECK(sameResult(lex([&] { return lexer.tokenizeSpeculative(input, threadCount); }), expected));
+            }
+        }
+
+        // Random inputs, some of them being invalid
+        for (size_t i = 0; i < 200; i++) {
+            std::string input = randomInput(random, 1 + i);
+            auto expected = lex([&] { return lexer.tokenize(input); });
+
+            for (size_t threadCount : {2, 4, 9}) {
+                CHECK(sameResult(lex([&] { return lexer.tokenizeSpeculative(input, threadCount); }), expected));
+            }
+        }
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "TestUtils.hpp"
+#include "StaticLexic.hpp"
+#include "TrieBuilder.hpp"
+
+namespace {
+    using Tokens = std::vector<std::pair<std::string, std::string>>;
+
+    // The lexics of the resources, in the order of loadCombinedLexic, then literals of higher and equal priority
+    static constexpr StaticTokenRule rules[] = {
+        {"[a-zA-Z_][a-zA-Z0-9_]*", "IDENTIFIER", 10},
+        {"\\+", "PLUS", 10}, {"-", "MINUS", 10}, {"\\*", "STAR", 10}, {"/", "DIVISION", 10}, {"%", "MODULO", 10},
+        {"\\(", "OPENING_PARENTHESIS", 10}, {"\\)", "CLOSING_PARENTHESIS", 10},
+        {"{", "OPENING_BRACKET", 10}, {"}", "CLOSING_BRACKET", 10},
+        {"\\[", "OPENING_SQUARE_BRACKET", 10}, {"\\]", "CLOSING_SQUARE_BRACKET", 10},
+        {"[0-9]+", "NUM", 10},
+        {"[0-9]*\\.[0-9]*([eE][+\\-]?[0-9]+)?|[0-9]+[eE][+\\-]?[0-9]+", "FLOAT", 10},
+        {"if", "IF", 20}, {"do", "DO", 10}
+    };
+    static constexpr auto dfa = compileLexic<64>(rules);
+
+    // Two rules of equal priority matching the same lexeme, in both orders
+    static constexpr StaticTokenRule firstRules[] = {{"ab", "FIRST", 1}, {"a[a-z]", "SECOND", 1}};
+    static constexpr StaticTokenRule secondRules[] = {{"a[a-z]", "SECOND", 1}, {"ab", "FIRST", 1}};
+    static constexpr auto firstDFA = compileLexic<8>(firstRules);
+    static constexpr auto secondDFA = compileLexic<8>(secondRules);
+
+    /**
+     * Extracts the tokens of an input, an error being reported as an empty list and its offset.
+     */
+    template <typename LexerType>
+    std::pair<size_t, Tokens> extract(LexerType& lexer, const std::string& input) {
+        try {
+            return {SIZE_MAX, lexer.extractTokens(input)};
+        } catch (const LexicalErrorException& e) {
+            return {e.offset(), {}};
+        }
+    }
+}
+
+int main() {
+    std::mt19937 random(26);
+
+    // The runtime lexer of the same rules: the literals are merged after the lexics, so that the lexics
+    // win the ties as the rules declared first do
+    Lexer lexer(TrieBuilder::merge(loadCombinedLexic().toDFA(), {{"if", "IF", 20}, {"do", "DO", 10}}));
+    StaticLexer<dfa> staticLexer;
+
+    // Priorities, ties and the overlap of the numbers and the floats
+    Tokens expected = {{"if", "IF"}, {"iff", "IDENTIFIER"}, {"do", "IDENTIFIER"}, {"12", "NUM"}, {"12.5", "FLOAT"},
+                       {"12e3", "FLOAT"}, {".", "FLOAT"}, {"1.", "FLOAT"}, {"1", "NUM"}, {"e", "IDENTIFIER"},
+                       {"+", "PLUS"}, {"3.5E-2", "FLOAT"}};
+    std::string input = "if iff do 12 12.5 12e3 . 1. 1e+ 3.5E-2";
+    CHECK(extract(staticLexer, input) == std::make_pair(SIZE_MAX, expected));
+    CHECK(extract(lexer, input) == std::make_pair(SIZE_MAX, expected));
+
+    // The static lexer gives the tokens and the errors of the runtime lexer
+    std::vector<std::string> inputs = {"", " ", "1 + 2 * (3e-2 * (2 - 4))", readResource("main.code")};
+    for (size_t i = 0; i < 300; i++) {
+        inputs.push_back(randomValidInput(random, 1 + i % 30));
+        inputs.push_back(randomInput(random, 1 + i % 40, "abzXY_0189.eE+-*/%(){}[] \nifdo#"));
+    }
+    for (const std::string& text : inputs) {
+        CHECK(extract(staticLexer, text) == extract(lexer, text));
+    }
+
+    // Between rules of equal priority, the first declared wins
+    StaticLexer<firstDFA> first;
+    StaticLexer<secondDFA> second;
+    CHECK(first.extractTokens("ab ac") == Tokens({{"ab", "FIRST"}, {"ac", "SECOND"}}));
+    CHECK(second.extractTokens("ab ac") == Tokens({{"ab", "SECOND"}, {"ac", "SECOND"}}));
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <set>
+#include <thread>
+
+#include "TestUtils.hpp"
+
+int main() {
+    // The ids are given in order and a string keeps its id
+    SymbolTable table;
+    CHECK(table.size() == 0);
+    CHECK(table.intern("a") == 0);
+    CHECK(table.intern("b") == 1);
+    CHECK(table.intern("a") == 0);
+    CHECK(table.intern("") == 2);
+    CHECK(table.size() == 3);
+    CHECK(table.name(1) == "b");
+    CHECK(table.name(2).empty());
+
+    bool thrown = false;
+    try {
+        table.name(3);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // Enough strings to fill several chunks of the directory and grow the shards
+    for (size_t i = 0; i < 10000; i++) {
+        CHECK(table.intern("name" + std::to_string(i)) == i + 3);
+    }
+    for (size_t i = 0; i < 10000; i++) {
+        CHECK(table.name(static_cast<uint32_t>(i + 3)) == "name" + std::to_string(i));
+    }
+
+    // Concurrent interning of overlapping strings: the ids stay dense and each string has a single id
+    SymbolTable shared;
+    const size_t threadCount = 8;
+    const size_t nameCount = 20000;
+    std::vector<std::vector<uint32_t>> ids(threadCount, std::vector<uint32_t>(nameCount));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&shared, &ids, t, nameCount] {
+            for (size_t i = 0; i < nameCount; i++) {
+                size_t n = (i * 7 + t * 1000) % nameCount;
+                ids[t][n] = shared.intern("x" + std::to_string(n));
+                // The string of an id is readable right after interning it
+                if (shared.name(ids[t][n]) != "x" + std::to_string(n)) {
+                    ids[t][n] = SymbolTable::NoSymbol;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(shared.size() == nameCount);
+    std::set<uint32_t> distinct;
+    for (size_t n = 0; n < nameCount; n++) {
+        for (size_t t = 0; t < threadCount; t++) {
+            CHECK(ids[t][n] == ids[0][n]);
+        }
+        CHECK(ids[0][n] < nameCount);
+        CHECK(shared.name(ids[0][n]) == "x" + std::to_string(n));
+        distinct.insert(ids[0][n]);
+    }
+    CHECK(distinct.size() == nameCount);
+
+    // The identifiers of an input lexed on several threads are interned once
+    std::mt19937 random(48);
+    Lexer lexer(loadCombinedLexic());
+    std::string input = randomValidInput(random, 200000);
+    SymbolTable symbols;
+    std::vector<SymbolToken> tokens = lexer.tokenizeSymbols(input, symbols, 4);
+    std::vector<Token> expected = lexer.tokenize(input);
+    CHECK(tokens.size() == expected.size());
+    int identifier = lexer.tokenId("IDENTIFIER");
+    for (size_t i = 0; i < tokens.size() && i < expected.size(); i++) {
+        const Token& token = expected[i];
+        CHECK(tokens[i].token.offset == token.offset && tokens[i].token.type == token.type);
+        if (token.type == identifier) {
+            CHECK(symbols.name(tokens[i].symbol) == std::string_view(input).substr(token.offset, token.length));
+        } else {
+            CHECK(tokens[i].symbol == SymbolTable::NoSymbol);
+        }
+    }
+    CHECK(symbols.size() == 5);     // "a", "test", "bite", "x_1" and "_" (see randomValidInput)
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "TestUtils.hpp"
+#include "TrieBuilder.hpp"
+
+int main() {
+    std::mt19937 random(33);
+
+    // The separators are sync characters of the resources lexics, the characters of the tokens aren't
+    Lexer lexer(loadCombinedLexic());
+    const SyncAnalysis& analysis = lexer.syncAnalysis();
+    CHECK(analysis.hasSyncCharacters());
+    CHECK(analysis.isSyncCharacter(' ') && analysis.isSyncCharacter('\n'));
+    CHECK(!analysis.isSyncCharacter('+') && !analysis.isBoundaryCharacter('+'));
+    CHECK(analysis.canStartToken('a') && analysis.canStartToken('.') && !analysis.canStartToken(' '));
+    CHECK(analysis.maxTokenLength() == SyncAnalysis::Unbounded);
+
+    std::string input = "ab + 12\n.5";
+    CHECK(analysis.nextSyncPoint(input, 0, input.length()) == 2);
+    CHECK(analysis.nextSyncPoint(input, 8, input.length()) == std::string::npos);
+    CHECK(analysis.previousSyncPoint(input, 8) == 7);
+    CHECK(analysis.previousSyncPoint(input, 2) == 0);
+
+    // A float lexing backtracks ("1e" is lexed as "1" and "e"), so its runs aren't bounded
+    CHECK(analysis.convergenceLength() == SyncAnalysis::Unbounded);
+
+    // The identifiers and the operators are lexed the same from the next character on
+    Lexer identifiers(NFA::combine({
+        NFAIO::loadFromFilename(resourcePath("identifier_lexic.json")),
+        NFAIO::loadFromFilename(resourcePath("operator_lexic.json"))
+    }));
+    CHECK(identifiers.syncAnalysis().convergenceLength() == 1);
+
+    // A run started inside "ab" reads "b" instead, and the runs agree after the following character
+    std::vector<TrieBuilder::Literal> literals = {{"a", "A", 1}, {"ab", "AB", 1}, {"b", "B", 1}, {" ", "SPACE", 1}};
+    Lexer trie(TrieBuilder::build(literals));
+    CHECK(!trie.syncAnalysis().isSyncCharacter(' '));
+    CHECK(trie.syncAnalysis().convergenceLength() == 2);
+
+    // The runs of an identifier and of a number started inside it never agree
+    Lexer numbers(NFA::combine({
+        NFAIO::loadFromFilename(resourcePath("identifier_lexic.json")),
+        NFAIO::loadFromFilename(resourcePath("num_lexic.json"))
+    }));
+    CHECK(numbers.syncAnalysis().convergenceLength() == SyncAnalysis::Unbounded);
+
+    // The speculative lexing of the bounded lexic starts before the chunks, its tokens are the sequential ones
+    std::string text;
+    std::uniform_int_distribution<int> character(0, 2);
+    for (size_t i = 0; i < 100000; i++) {
+        text += "ab "[character(random)];
+    }
+    for (size_t threadCount : {2, 3, 8}) {
+        CHECK(sameTokens(trie.tokenizeSpeculative(text, threadCount), trie.tokenize(text)));
+        CHECK(sameTokens(trie.tokenize(text, threadCount), trie.tokenize(text)));
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef __TEST_UTILS_HPP__
+#define __TEST_UTILS_HPP__
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "NFAIO.hpp"
+#include "Lexer.hpp"
+#include "LexicalErrorException.hpp"
+
+/**
+ * The number of failed checks of the test.
+ */
+static int testFailures = 0;
+
+/**
+ * Checks a condition, reporting it (and the line) when it doesn't hold.
+ */
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl; \
+            testFailures++; \
+        } \
+    } while (false)
+
+/**
+ * A function that returns the path of a file of the resources directory.
+ * @param name - std::string - The name of the file.
+ * @return std::string - The path of the file.
+ */
+inline std::string resourcePath(const std::string& name) {
+    return std::string(LEXER_RESOURCES_DIR) + "/" + name;
+}
+
+/**
+ * A function that reads a file of the resources directory.
+ * @param name - std::string - The name of the file.
+ * @return std::string - The content of the file.
+ */
+inline std::string readResource(const std::string& name) {
+    std::ifstream file(resourcePath(name));
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * A function that returns the NFA combining the lexics of the resources directory (as in main).
+ * @return NFA - The combined NFA, which has empty transitions.
+ */
+inline NFA loadCombinedLexic() {
+    return NFA::combine({
+        NFAIO::loadFromFilename(resourcePath("identifier_lexic.json")),
+        NFAIO::loadFromFilename(resourcePath("operator_lexic.json")),
+        NFAIO::loadFromFilename(resourcePath("num_lexic.json")),
+        NFAIO::loadFromFilename(resourcePath("float_lexic.json"))
+    });
+}
+
+/**
+ * A function that generates a random input made of the given characters (by default, characters of the
+ * resources lexics and separators). Such an input may contain invalid tokens.
+ * @param random - std::mt19937 - The random generator.
+ * @param length - size_t - The length of the input.
+ * @param characters - std::string - The characters of the input.
+ * @return std::string - The input.
+ */
+inline std::string randomInput(std::mt19937& random, size_t length,
+                               const std::string& characters = "abzXY_0189.eE+-*/%(){}[]    \n") {
+    std::uniform_int_distribution<size_t> distribution(0, characters.length() - 1);
+    std::string input;
+
+    for (size_t i = 0; i < length; i++) {
+        input += characters[distribution(random)];
+    }
+
+    return input;
+}
+
+/**
+ * A function that generates a random valid input of the resources lexics, tokens being separated by spaces.
+ * @param random - std::mt19937 - The random generator.
+ * @param tokenCount - size_t - The number of tokens.
+ * @return std::string - The input.
+ */
+inline std::string randomValidInput(std::mt19937& random, size_t tokenCount) {
+    static const std::vector<std::string> tokens = {
+        "a", "test", "bite", "x_1", "_", "0", "42", "1234567", "0.5", "3e-2", "1.25E+10", ".5",
+        "+", "-", "*", "/", "%", "(", ")", "{", "}", "[", "]"
+    };
+    static const std::vector<std::string> separators = {" ", " ", " ", "\n", "  "};
+    std::uniform_int_distribution<size_t> token(0, tokens.size() - 1);
+    std::uniform_int_distribution<size_t> separator(0, separators.size() - 1);
+    std::string input;
+
+    for (size_t i = 0; i < tokenCount; i++) {
+        input += tokens[token(random)];
+        input += separators[separator(random)];
+    }
+
+    return input;
+}
+
+/**
+ * A function that compares two lists of tokens.
+ * @param a - std::vector<Token> - The first list.
+ * @param b - std::vector<Token> - The second list.
+ * @return bool - True if the lists contain the same spans with the same types.
+ */
+inline bool sameTokens(const std::vector<Token>& a, const std::vector<Token>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].offset != b[i].offset || a[i].length != b[i].length || a[i].type != b[i].type) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * A function that reports the result of the test.
+ * @return int - The exit code of the test.
+ */
+inline int testResult() {
+    if (testFailures > 0) {
+        std::cerr << testFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include <stdexcept>
+
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(46);
+
+    Lexer lexer(loadCombinedLexic());
+    std::string input = "a + 12 * (b - 3.5)";
+
+    // Each token is dispatched to the action of its type, the others to the fallback
+    std::vector<std::string> identifiers;
+    std::vector<std::string> numbers;
+    std::vector<std::string> others;
+    TokenActions actions(lexer);
+    actions.on("IDENTIFIER", [&identifiers](const char* begin, const char* end) { identifiers.emplace_back(begin, end); });
+    actions.on("NUM", [&numbers](const char* begin, const char* end) { numbers.emplace_back(begin, end); });
+    actions.otherwise([&others](const char* begin, const char* end) { others.emplace_back(begin, end); });
+    lexer.lex(input, actions);
+
+    CHECK(identifiers == std::vector<std::string>({"a", "b"}));
+    CHECK(numbers == std::vector<std::string>({"12"}));
+    CHECK(others == std::vector<std::string>({"+", "*", "(", "-", "3.5", ")"}));
+
+    // Registering an action again replaces it, the tokens without action are ignored without a fallback
+    size_t count = 0;
+    TokenActions counter(lexer);
+    counter.on("NUM", [](const char*, const char*) {});
+    counter.on("NUM", [&count](const char*, const char*) { count++; });
+    lexer.lex(input, counter);
+    CHECK(count == 1);
+
+    // The actions are dispatched by token id: every token of a random input reaches the action of its type
+    std::vector<size_t> counts(lexer.tokenCount(), 0);
+    TokenActions all(lexer);
+    for (size_t id = 0; id < lexer.tokenCount(); id++) {
+        all.on(lexer.tokenType(id), [&counts, id](const char*, const char*) { counts[id]++; });
+    }
+    std::string text = randomValidInput(random, 1000);
+    lexer.lex(text, all);
+    std::vector<size_t> expected(lexer.tokenCount(), 0);
+    for (const Token& token : lexer.tokenize(text)) {
+        expected[token.type]++;
+    }
+    CHECK(counts == expected);
+
+    // An unknown token type is rejected
+    bool thrown = false;
+    try {
+        actions.on("KEYWORD", [](const char*, const char*) {});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "TestUtils.hpp"
+
+namespace {
+    /**
+     * Checks that the arrays of a buffer hold the given tokens.
+     */
+    bool sameTokens(const TokenBuffer& buffer, const std::vector<Token>& tokens) {
+        if (buffer.size() != tokens.size() || buffer.offsets().size() != tokens.size() ||
+            buffer.lengths().size() != tokens.size() || buffer.types().size() != tokens.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < tokens.size(); i++) {
+            if (buffer.offsets()[i] != tokens[i].offset || buffer.lengths()[i] != tokens[i].length ||
+                buffer.types()[i] != tokens[i].type || buffer[i].offset != tokens[i].offset) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    std::mt19937 random(42);
+
+    Lexer lexer(loadCombinedLexic());
+    TokenBuffer buffer;
+    CHECK(buffer.empty());
+
+    // The arrays hold the tokens of tokenize
+    std::string input = randomValidInput(random, 2000);
+    lexer.tokenize(input, buffer);
+    CHECK(sameTokens(buffer, lexer.tokenize(input)));
+
+    // The tokens are appended
+    std::string next = randomValidInput(random, 10);
+    std::vector<Token> expected = lexer.tokenize(input);
+    for (const Token& token : lexer.tokenize(next)) {
+        expected.push_back(token);
+    }
+    lexer.tokenize(next, buffer);
+    CHECK(sameTokens(buffer, expected));
+
+    // A cleared buffer is reused without reallocation
+    size_t capacity = buffer.capacity();
+    const size_t* offsets = buffer.offsets().data();
+    const size_t* lengths = buffer.lengths().data();
+    const int* types = buffer.types().data();
+    for (size_t i = 0; i < 20; i++) {
+        buffer.clear();
+        CHECK(buffer.empty() && buffer.capacity() == capacity);
+
+        input = randomValidInput(random, 1 + i * 50);
+        lexer.tokenize(input, buffer);
+        CHECK(sameTokens(buffer, lexer.tokenize(input)));
+        CHECK(buffer.capacity() == capacity);
+        CHECK(buffer.offsets().data() == offsets && buffer.lengths().data() == lengths && buffer.types().data() == types);
+    }
+
+    // A reserved buffer doesn't grow while it is filled
+    TokenBuffer reserved;
+    reserved.reserve(expected.size());
+    capacity = reserved.capacity();
+    lexer.tokenize(next, reserved);
+    CHECK(reserved.capacity() == capacity && reserved.size() == lexer.tokenize(next).size());
+
+    return testResult();
+}
\ No newline at end of file
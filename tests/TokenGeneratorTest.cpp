@@ -0,0 +1,97 @@
+#include "TestUtils.hpp"
+
+#if defined(__cpp_impl_coroutine)
+namespace {
+    /**
+     * A coroutine consuming the tokens of an AsyncTokenGenerator, keeping them with their characters.
+     */
+    struct Consumer {
+        struct promise_type {
+            Consumer get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    Consumer consume(AsyncTokenGenerator& generator, std::vector<Token>& tokens, std::vector<std::string>& texts,
+                     bool& done) {
+        while (auto token = co_await generator.next()) {
+            tokens.push_back(token->token);
+            texts.emplace_back(token->text);
+        }
+        done = true;
+    }
+
+    /**
+     * Cuts a text in chunks of random lengths (mostly in the middle of tokens).
+     */
+    std::vector<std::string> randomChunks(std::mt19937& random, const std::string& text, size_t maxLength) {
+        std::uniform_int_distribution<size_t> chunkLength(1, maxLength);
+        std::vector<std::string> chunks;
+        for (size_t position = 0; position < text.length();) {
+            size_t length = std::min(chunkLength(random), text.length() - position);
+            chunks.push_back(text.substr(position, length));
+            position += length;
+        }
+        return chunks;
+    }
+
+    /**
+     * Checks that the tokens streamed from the chunks of a text are its tokens.
+     */
+    void checkStream(const Lexer& lexer, const std::string& text, const std::vector<std::string>& chunks) {
+        InputChannel channel;
+        AsyncTokenGenerator generator = lexer.lexAsync(channel);
+        std::vector<Token> tokens;
+        std::vector<std::string> texts;
+        bool done = false;
+
+        consume(generator, tokens, texts, done);
+        for (const std::string& chunk : chunks) {
+            CHECK(!done);
+            channel.push(chunk);
+        }
+        channel.close();
+        CHECK(done);
+
+        CHECK(sameTokens(tokens, lexer.tokenize(text)));
+        for (size_t i = 0; i < tokens.size() && i < texts.size(); i++) {
+            CHECK(texts[i] == text.substr(tokens[i].offset, tokens[i].length));
+        }
+    }
+}
+#endif
+
+int main() {
+#if defined(__cpp_impl_coroutine)
+    std::mt19937 random(44);
+
+    NFA dfa = loadCombinedLexic().toDFA();
+    dfa.addKeyword({"test", "TEST", "IDENTIFIER"});
+    Lexer lexer(dfa);
+
+    // The generated tokens are the ones of tokenize
+    for (size_t i = 0; i < 50; i++) {
+        std::string text = randomValidInput(random, i * 3);
+        std::vector<Token> tokens;
+        for (const Token& token : lexer.generate(text)) {
+            tokens.push_back(token);
+        }
+        CHECK(sameTokens(tokens, lexer.tokenize(text)));
+    }
+
+    // The streamed tokens too, whatever the cuts of the stream
+    std::string text = "test + 1234.5e+10 abc";
+    checkStream(lexer, text, {"te", "st + 12", "34", ".", "5e", "+1", "0 ab", "c"});
+    checkStream(lexer, text, {text});
+    checkStream(lexer, "", {});
+    for (size_t i = 0; i < 50; i++) {
+        text = randomValidInput(random, 1 + i * 3);
+        checkStream(lexer, text, randomChunks(random, text, 1 + i % 10));
+    }
+#endif
+
+    return testResult();
+}
\ No newline at end of file
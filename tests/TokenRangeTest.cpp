@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <iterator>
+
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(43);
+
+    Lexer lexer(loadCombinedLexic());
+
+    // Iterating the range gives the tokens of tokenize
+    for (size_t i = 0; i < 50; i++) {
+        std::string input = randomValidInput(random, i * 4) + ((i % 2 == 0) ? "  \n" : "");
+        std::vector<Token> tokens;
+        for (const Token& token : lexer.tokens(input)) {
+            tokens.push_back(token);
+        }
+        CHECK(sameTokens(tokens, lexer.tokenize(input)));
+
+        // Standard algorithms work on the range
+        TokenRange range = lexer.tokens(input);
+        CHECK(static_cast<size_t>(std::distance(range.begin(), range.end())) == tokens.size());
+    }
+
+    // The lexing stops at the token found by the algorithm
+    std::string input = "a + 12 * (b - 3.5)";
+    TokenRange range = lexer.tokens(input);
+    int number = lexer.tokenId("NUM");
+    TokenRange::Iterator it = std::find_if(range.begin(), range.end(), [number](const Token& token) { return token.type == number; });
+    CHECK(it != range.end() && it->offset == 4 && it->length == 2);
+    ++it;
+    CHECK(it != range.end() && input.substr(it->offset, it->length) == "*");
+
+    // The post-increment returns the previous token
+    TokenRange::Iterator previous = it++;
+    CHECK(previous->offset == 7 && it->offset == 9);
+
+    // An input without tokens gives an empty range
+    for (const std::string& text : {std::string(), std::string(" \n ")}) {
+        TokenRange emptyRange = lexer.tokens(text);
+        CHECK(emptyRange.begin() == emptyRange.end());
+    }
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "TestUtils.hpp"
+
+namespace {
+    /**
+     * A sink collecting the tokens as spans of the input.
+     */
+    struct Collector {
+        const char* data;
+        std::vector<Token> tokens;
+
+        void onToken(int type, const char* begin, const char* end) {
+            tokens.push_back(Token{static_cast<size_t>(begin - data), static_cast<size_t>(end - begin), type});
+        }
+    };
+
+    /**
+     * A sink also receiving the invalid parts of the input.
+     */
+    struct RecoveringCollector : Collector {
+        std::vector<Token> errors;
+
+        void onError(const char* begin, const char* end) {
+            errors.push_back(Token{static_cast<size_t>(begin - data), static_cast<size_t>(end - begin), Lexer::ErrorToken});
+        }
+    };
+}
+
+int main() {
+    std::mt19937 random(45);
+
+    Lexer lexer(loadCombinedLexic());
+
+    for (size_t i = 0; i < 50; i++) {
+        std::string input = randomValidInput(random, 1 + i * 5);
+        std::vector<Token> expected = lexer.tokenize(input);
+
+        // A callable sink
+        std::vector<Token> tokens;
+        lexer.lex(input, [&tokens, &input](int type, const char* begin, const char* end) {
+            tokens.push_back(Token{static_cast<size_t>(begin - input.data()), static_cast<size_t>(end - begin), type});
+        });
+        CHECK(sameTokens(tokens, expected));
+
+        // An object sink
+        Collector collector{input.data(), {}};
+        lexer.lex(input, collector);
+        CHECK(sameTokens(collector.tokens, expected));
+
+        // A sink with onError on a valid input
+        RecoveringCollector recovering{{input.data(), {}}, {}};
+        lexer.lex(input, recovering);
+        CHECK(sameTokens(recovering.tokens, expected) && recovering.errors.empty());
+    }
+
+    // The invalid parts are passed to onError with their offsets, and the lexing continues
+    std::string input = "ab #$ 12 @x";
+    RecoveringCollector recovering{{input.data(), {}}, {}};
+    bool thrown = false;
+    try {
+        lexer.lex(input, recovering);
+    } catch (const std::exception&) {
+        thrown = true;
+    }
+    CHECK(!thrown);
+    CHECK(sameTokens(recovering.errors, {Token{3, 2, Lexer::ErrorToken}, Token{9, 1, Lexer::ErrorToken}}));
+    std::vector<Token> tokens = lexer.tokenizeWithRecovery(input);
+    std::vector<Token> validTokens;
+    std::copy_if(tokens.begin(), tokens.end(), std::back_inserter(validTokens),
+                 [](const Token& token) { return token.type != Lexer::ErrorToken; });
+    CHECK(sameTokens(recovering.tokens, validTokens));
+
+    return testResult();
+}
\ No newline at end of file
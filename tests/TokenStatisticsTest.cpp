@@ -0,0 +1,41 @@
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(41);
+
+    Lexer lexer(loadCombinedLexic());
+
+    // Random inputs, with tokens longer than the histograms
+    std::string input = randomValidInput(random, 5000);
+    for (size_t length : {TokenStatistics::HistogramSize - 2, TokenStatistics::HistogramSize - 1,
+                          TokenStatistics::HistogramSize, size_t(200)}) {
+        input += " " + std::string(length, 'x') + " " + std::string(length, '7');
+    }
+
+    std::vector<size_t> counts(lexer.tokenCount(), 0);
+    std::vector<std::vector<size_t>> histograms(lexer.tokenCount(), std::vector<size_t>(TokenStatistics::HistogramSize, 0));
+    for (const Token& token : lexer.tokenize(input)) {
+        counts[token.type]++;
+        histograms[token.type][std::min(token.length, TokenStatistics::HistogramSize - 1)]++;
+    }
+
+    TokenStatistics statistics = lexer.count(input);
+    CHECK(statistics.counts == counts);
+    CHECK(statistics.histograms.empty());
+
+    statistics = lexer.count(input, true);
+    CHECK(statistics.counts == counts);
+    CHECK(statistics.histograms == histograms);
+
+    // The tokens of HistogramSize - 1 characters and the longer ones share the last bucket
+    int identifier = lexer.tokenId("IDENTIFIER");
+    CHECK(statistics.histograms[identifier][TokenStatistics::HistogramSize - 2] >= 1);
+    CHECK(statistics.histograms[identifier][TokenStatistics::HistogramSize - 1] >= 3);
+
+    // An empty input has no tokens
+    statistics = lexer.count("", true);
+    CHECK(statistics.counts == std::vector<size_t>(lexer.tokenCount(), 0));
+    CHECK(statistics.histograms.size() == lexer.tokenCount());
+
+    return testResult();
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <stdexcept>
+
+#include "TestUtils.hpp"
+#include "TrieBuilder.hpp"
+
+namespace {
+    using Tokens = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * Extracts the tokens of an input, an error being reported as an empty list and a thrown flag.
+     */
+    std::pair<bool, Tokens> extract(const NFA& nfa, Lexer::Engine engine, const std::string& input) {
+        try {
+            Lexer lexer(nfa, engine);
+            return {true, lexer.extractTokens(input)};
+        } catch (const LexicalErrorException&) {
+            return {false, {}};
+        }
+    }
+
+    /**
+     * Indicates if a function throws a std::runtime_error.
+     */
+    template <typename Function>
+    bool throws(Function function) {
+        try {
+            function();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+int main() {
+    std::mt19937 random(50);
+
+    // The trie of literals sharing prefixes
+    NFA trie = TrieBuilder::build({{"+", "PLUS", 1}, {"++", "INCREMENT", 1}, {"+=", "PLUS_ASSIGN", 1}, {"-", "MINUS", 1}});
+    CHECK(trie.isDeterministic());
+    Tokens expected = {{"+", "PLUS"}, {"++", "INCREMENT"}, {"+=", "PLUS_ASSIGN"}, {"++", "INCREMENT"}, {"+", "PLUS"},
+                       {"-", "MINUS"}};
+    CHECK(extract(trie, Lexer::Engine::Auto, "+ ++ +=+++-") == std::make_pair(true, expected));
+
+    // Empty literals and literals declared twice with the same type are rejected
+    CHECK(throws([] { TrieBuilder::build({{"", "EMPTY", 1}}); }));
+    CHECK(throws([] { TrieBuilder::build({{"if", "IF", 1}, {"if", "IF", 2}}); }));
+
+    // A text with several types gives the highest priority, then the first declared
+    NFA ties = TrieBuilder::build({{"if", "IF", 1}, {"if", "CONDITION", 1}, {"do", "DO", 1}, {"do", "LOOP", 2}});
+    CHECK(extract(ties, Lexer::Engine::Auto, "if do") == std::make_pair(true, Tokens{{"if", "IF"}, {"do", "LOOP"}}));
+    CHECK(extract(ties, Lexer::Engine::Traverser, "if do") == std::make_pair(true, Tokens{{"if", "IF"}, {"do", "LOOP"}}));
+
+    // Merging literals into a DFA gives the tokens of NFA::combine followed by toDFA, ties included
+    NFA dfa = loadCombinedLexic().toDFA();
+    dfa.addKeyword({"test", "TEST", "IDENTIFIER"});
+    std::vector<TrieBuilder::Literal> literals = {
+        {"if", "IF", 20}, {"while", "WHILE", 20}, {"->", "ARROW", 10}, {"=", "ASSIGN", 10}, {"==", "EQUAL", 10},
+        {"+=", "PLUS_ASSIGN", 10}, {"+", "ADD", 10}, {"1st", "FIRST", 10}
+    };
+    NFA merged = TrieBuilder::merge(dfa, literals);
+    NFA combined = NFA::combine({dfa, TrieBuilder::build(literals)}).toDFA();
+    CHECK(merged.isDeterministic());
+    CHECK(merged.keywords().size() == 1);
+
+    std::vector<std::string> inputs = {"", "if iff whilewhile while", "a->b == c = d += 1st + 1 - -> 1s", readResource("main.code")};
+    for (size_t i = 0; i < 300; i++) {
+        inputs.push_back(randomValidInput(random, 1 + i % 30));
+        inputs.push_back(randomInput(random, 1 + i % 40, "ifwhlest1a_0.+-=>()  \n"));
+    }
+    for (const std::string& input : inputs) {
+        std::pair<bool, Tokens> reference = extract(combined, Lexer::Engine::Auto, input);
+
+        CHECK(extract(merged, Lexer::Engine::Auto, input) == reference);
+        CHECK(extract(merged, Lexer::Engine::Traverser, input) == reference);
+    }
+    CHECK(extract(merged, Lexer::Engine::Auto, "if + test") ==
+          std::make_pair(true, Tokens{{"if", "IF"}, {"+", "PLUS"}, {"test", "TEST"}}));
+
+    // The NFA must be deterministic
+    CHECK(throws([] { TrieBuilder::merge(loadCombinedLexic(), {{"if", "IF", 20}}); }));
+
+    return testResult();
+}
\ No newline at end of file
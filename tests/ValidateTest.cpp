@@ -0,0 +1,36 @@
+#include "TestUtils.hpp"
+
+int main() {
+    std::mt19937 random(40);
+
+    Lexer lexer(loadCombinedLexic());
+
+    // Valid inputs
+    for (const std::string& input : {std::string(), std::string(" \n "), std::string("1 + 2 * (3e-2 * (2 - 4))"),
+                                     readResource("main.code")}) {
+        CHECK(lexer.validate(input) == std::make_pair(true, input.length()));
+    }
+    for (size_t i = 0; i < 100; i++) {
+        std::string input = randomValidInput(random, 1 + i % 50);
+        CHECK(lexer.validate(input) == std::make_pair(true, input.length()));
+    }
+
+    // The first invalid token is reported at the offset of the error of tokenize
+    CHECK(lexer.validate("ab #$ 12 @") == std::make_pair(false, size_t(3)));
+    size_t invalidCount = 0;
+    for (size_t i = 0; i < 300; i++) {
+        std::string input = randomInput(random, 1 + i % 60, "abzXY_0189.eE+-*/%(){}[] #@\n");
+        std::pair<bool, size_t> result = lexer.validate(input);
+
+        try {
+            lexer.tokenize(input);
+            CHECK(result == std::make_pair(true, input.length()));
+        } catch (const LexicalErrorException& e) {
+            CHECK(result == std::make_pair(false, e.offset()));
+            invalidCount++;
+        }
+    }
+    CHECK(invalidCount > 50);
+
+    return testResult();
+}
\ No newline at end of file